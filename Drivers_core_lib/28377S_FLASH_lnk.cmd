@@ -110,6 +110,7 @@ SECTIONS
    .stack              : > RAMM1        PAGE = 1
    .ebss               : >> RAMLS5 | RAMGS0 | RAMGS1       PAGE = 1
    .esysmem            : > RAMLS5       PAGE = 1
+   ramgs_dma           : > RAMGS2       PAGE = 1    /* data of drivers accessed by DMA, DMA can access only GS RAM */
 
    /* Initalized sections go in Flash */
    .econst             : >> FLASHF | FLASHG | FLASHH      PAGE = 0, ALIGN(4)
@@ -0,0 +1,501 @@
+/**
+ * @file DriverADC.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of ADC driver working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverADC.h"
+
+#define ADC_NUMBER                4
+#define ADC_INT_NUMBER            4
+#define ADC_CTL1_INTPULSEPOS      0x0004    //ADCINT at end of conversion, result is latched
+#define ADC_CTL1_ADCPWDNZ         0x0080
+#define ADC_INTSEL_E              0x0020    //ADCINTSELxNy.INTxE, fields of 8 bits
+#define ADC_SOCCTL_CHSEL_SHIFT    15
+#define ADC_SOCCTL_TRIGSEL_SHIFT  20
+#define ADC_PIE_GROUP10           18        //offset of PIEIER10 from PIEIER1, in 16-bit registers
+#define ADC_PRESCALE_RESERVED     1         //ADCCTL2.PRESCALE code of SYSCLK / 1.5 is not valid
+
+/**
+ * @brief Hardware resources of one ADCINTx of converter
+ */
+typedef struct
+{
+  volatile PINT *vector;      //entry of PIE vector table
+  uint16_t pieGroup;          //offset of PIEIERx from PIEIER1, in 16-bit registers
+  uint16_t pieMask;           //bit of interrupt at PIEIERx
+  uint16_t ack;               //PIEACK and IER bit of PIE group
+} ADC_Resource;
+
+static __interrupt void ADCA1_ISR(void);
+static __interrupt void ADCA2_ISR(void);
+static __interrupt void ADCA3_ISR(void);
+static __interrupt void ADCA4_ISR(void);
+static __interrupt void ADCB1_ISR(void);
+static __interrupt void ADCB2_ISR(void);
+static __interrupt void ADCB3_ISR(void);
+static __interrupt void ADCB4_ISR(void);
+static __interrupt void ADCC1_ISR(void);
+static __interrupt void ADCC2_ISR(void);
+static __interrupt void ADCC3_ISR(void);
+static __interrupt void ADCC4_ISR(void);
+static __interrupt void ADCD1_ISR(void);
+static __interrupt void ADCD2_ISR(void);
+static __interrupt void ADCD3_ISR(void);
+static __interrupt void ADCD4_ISR(void);
+
+static volatile struct ADC_REGS* const ADC_REGISTERS[ADC_NUMBER] =
+{
+  &AdcaRegs, &AdcbRegs, &AdccRegs, &AdcdRegs
+};
+
+static volatile struct ADC_RESULT_REGS* const ADC_RESULTS[ADC_NUMBER] =
+{
+  &AdcaResultRegs, &AdcbResultRegs, &AdccResultRegs, &AdcdResultRegs
+};
+
+//ADCx1 is at group 1 with gap of XINT, ADCx2 - ADCx4 are at group 10 after ADCx_EVT
+static const ADC_Resource ADC_RESOURCES[ADC_NUMBER][ADC_INT_NUMBER] =
+{
+  {
+    { &PieVectTable.ADCA1_INT, 0, 0x0001, M_INT1 },                   //INT1.1
+    { &PieVectTable.ADCA2_INT, ADC_PIE_GROUP10, 0x0002, M_INT10 },    //INT10.2
+    { &PieVectTable.ADCA3_INT, ADC_PIE_GROUP10, 0x0004, M_INT10 },    //INT10.3
+    { &PieVectTable.ADCA4_INT, ADC_PIE_GROUP10, 0x0008, M_INT10 },    //INT10.4
+  },
+  {
+    { &PieVectTable.ADCB1_INT, 0, 0x0002, M_INT1 },                   //INT1.2
+    { &PieVectTable.ADCB2_INT, ADC_PIE_GROUP10, 0x0020, M_INT10 },    //INT10.6
+    { &PieVectTable.ADCB3_INT, ADC_PIE_GROUP10, 0x0040, M_INT10 },    //INT10.7
+    { &PieVectTable.ADCB4_INT, ADC_PIE_GROUP10, 0x0080, M_INT10 },    //INT10.8
+  },
+  {
+    { &PieVectTable.ADCC1_INT, 0, 0x0004, M_INT1 },                   //INT1.3
+    { &PieVectTable.ADCC2_INT, ADC_PIE_GROUP10, 0x0200, M_INT10 },    //INT10.10
+    { &PieVectTable.ADCC3_INT, ADC_PIE_GROUP10, 0x0400, M_INT10 },    //INT10.11
+    { &PieVectTable.ADCC4_INT, ADC_PIE_GROUP10, 0x0800, M_INT10 },    //INT10.12
+  },
+  {
+    { &PieVectTable.ADCD1_INT, 0, 0x0020, M_INT1 },                   //INT1.6
+    { &PieVectTable.ADCD2_INT, ADC_PIE_GROUP10, 0x2000, M_INT10 },    //INT10.14
+    { &PieVectTable.ADCD3_INT, ADC_PIE_GROUP10, 0x4000, M_INT10 },    //INT10.15
+    { &PieVectTable.ADCD4_INT, ADC_PIE_GROUP10, 0x8000, M_INT10 },    //INT10.16
+  },
+};
+
+static const PINT ADC_ISR[ADC_NUMBER][ADC_INT_NUMBER] =
+{
+  { &ADCA1_ISR, &ADCA2_ISR, &ADCA3_ISR, &ADCA4_ISR },
+  { &ADCB1_ISR, &ADCB2_ISR, &ADCB3_ISR, &ADCB4_ISR },
+  { &ADCC1_ISR, &ADCC2_ISR, &ADCC3_ISR, &ADCC4_ISR },
+  { &ADCD1_ISR, &ADCD2_ISR, &ADCD3_ISR, &ADCD4_ISR },
+};
+
+/**
+ * @brief State of driver, settings of ADC_Cfg are copied by adcCfg(), so only list of SOCs is kept until
+ * triggers are armed
+ */
+typedef struct
+{
+  uint16_t configured;                //adcCfg() was called
+  const ADC_Channel *channels;        //list of SOCs not armed yet, NULL after adcReady()
+  uint16_t number;
+  volatile uint32_t *clock;
+  uint32_t settle;
+  ADC_Callback callback;
+  uint16_t powered;                   //bit n - converter n is at list
+  uint16_t settled;                   //triggers are armed
+  uint32_t start;                     //clock at power up
+  ADC_Stats stats[ADC_NUMBER][ADC_INT_NUMBER];
+} ADC_State;
+
+static ADC_State adcState;
+
+//******************************************************STATIC FUNCTION**************************************************
+
+/**
+ * @brief Static function shared by ISR of all ADCINTx. Flag is cleared before callback, so conversion which
+ * ends during callback is not lost.
+ */
+static inline void ADC_DISPATCH(ADCType adc, uint16_t irq)
+{
+  volatile struct ADC_REGS *regs = ADC_REGISTERS[adc];
+  ADC_Stats *stats = &adcState.stats[adc][irq];
+  uint16_t bit = 1U << irq;
+
+  stats->count++;
+  if(regs->ADCINTOVF.all & bit)
+  {
+    stats->overflow++;
+    regs->ADCINTOVFCLR.all = bit;
+  }
+  regs->ADCINTFLGCLR.all = bit;
+
+  if(adcState.callback != NULL)
+  {
+    adcState.callback(adc, (ADC_IntType)(irq + ADC_INT1));
+  }
+
+  PieCtrlRegs.PIEACK.all = ADC_RESOURCES[adc][irq].ack;
+}
+
+static __interrupt void ADCA1_ISR(void)
+{
+  ADC_DISPATCH(ADC_A, 0);
+}
+
+static __interrupt void ADCA2_ISR(void)
+{
+  ADC_DISPATCH(ADC_A, 1);
+}
+
+static __interrupt void ADCA3_ISR(void)
+{
+  ADC_DISPATCH(ADC_A, 2);
+}
+
+static __interrupt void ADCA4_ISR(void)
+{
+  ADC_DISPATCH(ADC_A, 3);
+}
+
+static __interrupt void ADCB1_ISR(void)
+{
+  ADC_DISPATCH(ADC_B, 0);
+}
+
+static __interrupt void ADCB2_ISR(void)
+{
+  ADC_DISPATCH(ADC_B, 1);
+}
+
+static __interrupt void ADCB3_ISR(void)
+{
+  ADC_DISPATCH(ADC_B, 2);
+}
+
+static __interrupt void ADCB4_ISR(void)
+{
+  ADC_DISPATCH(ADC_B, 3);
+}
+
+static __interrupt void ADCC1_ISR(void)
+{
+  ADC_DISPATCH(ADC_C, 0);
+}
+
+static __interrupt void ADCC2_ISR(void)
+{
+  ADC_DISPATCH(ADC_C, 1);
+}
+
+static __interrupt void ADCC3_ISR(void)
+{
+  ADC_DISPATCH(ADC_C, 2);
+}
+
+static __interrupt void ADCC4_ISR(void)
+{
+  ADC_DISPATCH(ADC_C, 3);
+}
+
+static __interrupt void ADCD1_ISR(void)
+{
+  ADC_DISPATCH(ADC_D, 0);
+}
+
+static __interrupt void ADCD2_ISR(void)
+{
+  ADC_DISPATCH(ADC_D, 1);
+}
+
+static __interrupt void ADCD3_ISR(void)
+{
+  ADC_DISPATCH(ADC_D, 2);
+}
+
+static __interrupt void ADCD4_ISR(void)
+{
+  ADC_DISPATCH(ADC_D, 3);
+}
+
+static volatile Uint32* ADC_SOC_CONTROL(ADCType adc, uint16_t soc)
+{
+  return &ADC_REGISTERS[adc]->ADCSOC0CTL.all + soc;
+}
+
+/**
+ * @brief Static function used to check list of SOCs. SOC can be used once and ADCINTx can be set by one SOC
+ * of converter.
+ */
+static err_adc ADC_CHECK(const ADC_Cfg *config)
+{
+  const ADC_Channel *channel = NULL;
+  uint16_t socs[ADC_NUMBER] = { 0, 0, 0, 0 };
+  uint16_t interrupts[ADC_NUMBER] = { 0, 0, 0, 0 };
+  uint16_t i = 0;
+
+  if((config == NULL) || (config->channels == NULL) || (config->number == 0) ||
+     (config->number > ADC_NUMBER * ADC_SOC_NUMBER) || (config->clock == NULL) ||
+     ((uint32_t)config->prescale >= ADC_DIV_MAX) || (config->prescale == ADC_PRESCALE_RESERVED))
+  {
+    return E_ADC_INVALID_PARAM;
+  }
+
+  //bit 0 of interrupts is ADC_INT_NONE, it can be used by many SOCs
+  for(i = 0; i < config->number; i++)
+  {
+    channel = &config->channels[i];
+    if(((uint32_t)channel->adc >= ADC_MAX) || (channel->soc >= ADC_SOC_NUMBER) ||
+       (channel->channel >= ADC_SOC_NUMBER) || (channel->trigger > ADC_TRIGGER_MAX) ||
+       (channel->acqps < ADC_ACQPS_MIN) || (channel->acqps > ADC_ACQPS_MAX) ||
+       ((uint32_t)channel->irq >= ADC_INT_MAX) || (socs[channel->adc] & (1U << channel->soc)) ||
+       (interrupts[channel->adc] & (1U << channel->irq) & ~1U))
+    {
+      return E_ADC_INVALID_PARAM;
+    }
+
+    socs[channel->adc] |= 1U << channel->soc;
+    interrupts[channel->adc] |= 1U << channel->irq;
+  }
+
+  return E_ADC_OK;
+}
+
+/**
+ * @brief Static function used to power up converter with SOCs and interrupts cleared. Must be called with
+ * EALLOW.
+ */
+static void ADC_POWER_UP(ADCType adc, ADC_PrescaleType prescale)
+{
+  volatile struct ADC_REGS *regs = ADC_REGISTERS[adc];
+  uint16_t soc = 0;
+
+  CpuSysRegs.PCLKCR13.all |= 1U << adc;
+
+  //12-bit single-ended mode
+  regs->ADCCTL2.all = (Uint16)prescale;
+  regs->ADCINTSEL1N2.all = 0;
+  regs->ADCINTSEL3N4.all = 0;
+  for(soc = 0; soc < ADC_SOC_NUMBER; soc++)
+  {
+    *ADC_SOC_CONTROL(adc, soc) = 0;
+  }
+  regs->ADCINTFLGCLR.all = 0x000F;
+  regs->ADCINTOVFCLR.all = 0x000F;
+  regs->ADCCTL1.all = ADC_CTL1_INTPULSEPOS | ADC_CTL1_ADCPWDNZ;
+}
+
+/**
+ * @brief Static function used to configure SOC with software trigger and its irq. Must be called with
+ * EALLOW.
+ */
+static void ADC_SOC(const ADC_Channel *channel)
+{
+  volatile Uint16 *select = NULL;
+  uint16_t index = 0;
+  uint16_t shift = 0;
+
+  *ADC_SOC_CONTROL(channel->adc, channel->soc) = (Uint32)channel->acqps |
+                                                 ((Uint32)channel->channel << ADC_SOCCTL_CHSEL_SHIFT);
+
+  if(channel->irq != ADC_INT_NONE)
+  {
+    index = channel->irq - ADC_INT1;
+    select = &ADC_REGISTERS[channel->adc]->ADCINTSEL1N2.all + index / 2;
+    shift = (index % 2) * 8;
+    *select = (*select & ~(0x00FFU << shift)) | ((channel->soc | ADC_INTSEL_E) << shift);
+
+    *ADC_RESOURCES[channel->adc][index].vector = ADC_ISR[channel->adc][index];
+  }
+}
+
+/**
+ * @brief Static function used to set triggers of SOCs and to enable interrupts of list
+ */
+static void ADC_ARM(const ADC_Channel *channels, uint16_t number)
+{
+  const ADC_Channel *channel = NULL;
+  const ADC_Resource *resource = NULL;
+  uint16_t i = 0;
+
+  EALLOW;
+  for(i = 0; i < number; i++)
+  {
+    channel = &channels[i];
+    *ADC_SOC_CONTROL(channel->adc, channel->soc) |= (Uint32)channel->trigger << ADC_SOCCTL_TRIGSEL_SHIFT;
+  }
+  EDIS;
+
+  for(i = 0; i < number; i++)
+  {
+    channel = &channels[i];
+    if(channel->irq != ADC_INT_NONE)
+    {
+      resource = &ADC_RESOURCES[channel->adc][channel->irq - ADC_INT1];
+      (&PieCtrlRegs.PIEIER1.all)[resource->pieGroup] |= resource->pieMask;
+      IER |= resource->ack;
+    }
+  }
+}
+
+static err_adc ADC_CHECK_SOC(ADCType adc, uint16_t soc)
+{
+  if(((uint32_t)adc >= ADC_MAX) || (soc >= ADC_SOC_NUMBER))
+  {
+    return E_ADC_INVALID_PARAM;
+  }
+
+  return (adcState.powered & (1U << adc)) ? E_ADC_OK : E_ADC_NOT_INITIALIZE;
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_adc adcCfg(const ADC_Cfg *config)
+{
+  err_adc ret = ADC_CHECK(config);
+  uint16_t powered = 0;
+  uint16_t adc = 0;
+  uint16_t i = 0;
+
+  if(ret != E_ADC_OK)
+  {
+    return ret;
+  }
+
+  for(i = 0; i < config->number; i++)
+  {
+    powered |= 1U << config->channels[i].adc;
+  }
+
+  //all converters are powered up at once, so they settle together
+  EALLOW;
+  for(adc = 0; adc < ADC_NUMBER; adc++)
+  {
+    if(powered & (1U << adc))
+    {
+      ADC_POWER_UP((ADCType)adc, config->prescale);
+    }
+  }
+  for(i = 0; i < config->number; i++)
+  {
+    ADC_SOC(&config->channels[i]);
+  }
+  EDIS;
+
+  adcState.start = *config->clock;
+  adcState.channels = config->channels;
+  adcState.number = config->number;
+  adcState.clock = config->clock;
+  adcState.settle = config->settle;
+  adcState.callback = config->callback;
+  adcState.configured = 1;
+  adcState.powered |= powered;
+  adcState.settled = 0;
+  for(adc = 0; adc < ADC_NUMBER; adc++)
+  {
+    for(i = 0; i < ADC_INT_NUMBER; i++)
+    {
+      adcState.stats[adc][i].count = 0;
+      adcState.stats[adc][i].overflow = 0;
+    }
+  }
+
+  return E_ADC_OK;
+}
+
+err_adc adcReady(void)
+{
+  if(!adcState.configured)
+  {
+    return E_ADC_NOT_INITIALIZE;
+  }
+
+  if(!adcState.settled)
+  {
+    //clock counts down
+    if((uint32_t)(adcState.start - *adcState.clock) < adcState.settle)
+    {
+      return E_ADC_BUSY;
+    }
+
+    //list of SOCs is not used after this, application can drop it
+    ADC_ARM(adcState.channels, adcState.number);
+    adcState.channels = NULL;
+    adcState.settled = 1;
+  }
+
+  return E_ADC_OK;
+}
+
+err_adc adcForce(ADCType adc, uint16_t mask)
+{
+  err_adc ret = ADC_CHECK_SOC(adc, 0);
+
+  if(ret == E_ADC_OK)
+  {
+    if(!adcState.settled)
+    {
+      ret = E_ADC_BUSY;
+    }
+    else
+    {
+      ADC_REGISTERS[adc]->ADCSOCFRC1.all = mask;
+    }
+  }
+
+  return ret;
+}
+
+err_adc adcRead(ADCType adc, uint16_t soc, uint16_t *value)
+{
+  err_adc ret = ADC_CHECK_SOC(adc, soc);
+
+  if((ret == E_ADC_OK) && (value != NULL))
+  {
+    *value = (&ADC_RESULTS[adc]->ADCRESULT0)[soc];
+  }
+  else if(ret == E_ADC_OK)
+  {
+    ret = E_ADC_INVALID_PARAM;
+  }
+
+  return ret;
+}
+
+err_adc adcResults(ADCType adc, uint16_t first, uint16_t number, uint16_t *values)
+{
+  err_adc ret = ADC_CHECK_SOC(adc, first);
+  const volatile Uint16 *result = NULL;
+  uint16_t i = 0;
+
+  if((ret == E_ADC_OK) && ((values == NULL) || (number == 0) || (first + number > ADC_SOC_NUMBER)))
+  {
+    ret = E_ADC_INVALID_PARAM;
+  }
+
+  if(ret == E_ADC_OK)
+  {
+    result = &ADC_RESULTS[adc]->ADCRESULT0 + first;
+    for(i = 0; i < number; i++)
+    {
+      values[i] = result[i];
+    }
+  }
+
+  return ret;
+}
+
+err_adc adcStats(ADCType adc, ADC_IntType irq, ADC_Stats *stats)
+{
+  if(((uint32_t)adc >= ADC_MAX) || (irq < ADC_INT1) || (irq >= ADC_INT_MAX) || (stats == NULL))
+  {
+    return E_ADC_INVALID_PARAM;
+  }
+
+  *stats = adcState.stats[adc][irq - ADC_INT1];
+  return E_ADC_OK;
+}
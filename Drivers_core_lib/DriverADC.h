@@ -0,0 +1,225 @@
+/**
+ * @file DriverADC.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of ADC driver for ADCA - ADCD. Conversions are declared by list of channels, one entry
+ * for each SOC with its input, trigger, acquisition window and ADCINT set at end of conversion. Converters
+ * of list are powered up together by adcCfg(), so one settling time is needed for all of them. Settling is
+ * measured by free running counter and SOC triggers are armed by adcReady() only after it, meanwhile
+ * application makes the rest of initialisation. Converters work in 12-bit single-ended mode, SOCs of one
+ * converter are sampled by round robin. Results are read from ADC_RESULT_REGS by adcRead() or by DMA.
+ *
+ *   static const ADC_Channel phases[] =
+ *   {
+ *     { ADC_A, 0, 2, ADC_TRIGGER_EPWM_SOCA(1), 14, ADC_INT_NONE },    //current of phase U
+ *     { ADC_B, 0, 2, ADC_TRIGGER_EPWM_SOCA(1), 14, ADC_INT_NONE },    //current of phase V
+ *     { ADC_C, 0, 2, ADC_TRIGGER_EPWM_SOCA(1), 14, ADC_INT1 },        //current of phase W, end of sequence
+ *   };
+ *   static const ADC_Cfg adc =
+ *   {
+ *     phases, 3, ADC_DIV_4_0,                                 //ADCCLK 50 MHz
+ *     &CpuTimer2Regs.TIM.all, ADC_SETTLE_CYCLES(200),         //free running timer, SYSCLK 200 MHz
+ *     control                                                 //called at end of sequence
+ *   };
+ *
+ *   adcCfg(&adc);
+ *   ...                                                       //rest of initialisation
+ *   while(adcReady() == E_ADC_BUSY)
+ *   {
+ *   }
+ */
+
+#ifndef DRIVERADC_H_
+#define DRIVERADC_H_
+
+#include <stdint.h>
+
+typedef int err_adc;
+
+/**
+ * @brief Numeric representation of ADC error
+ */
+#define E_ADC_OK                    0     //Operation successful
+#define E_ADC_INVALID_PARAM        -1     //Invalid parameters
+#define E_ADC_NOT_INITIALIZE       -2     //Converter is not configured
+#define E_ADC_BUSY                 -3     //Converters are not settled after power up
+
+/**
+ * @brief Triggers of SOC, ADCSOCxCTL.TRIGSEL codes
+ */
+#define ADC_TRIGGER_SOFTWARE        0                       //only adcForce()
+#define ADC_TRIGGER_TINT(n)         (1 + (n))               //CPU timer n, n = 0 - 2
+#define ADC_TRIGGER_EXTSOC          4                       //GPIO routed by Input X-BAR INPUT5
+#define ADC_TRIGGER_EPWM_SOCA(n)    (5 + 2 * ((n) - 1))     //ePWMn SOCA, n = 1 - 12
+#define ADC_TRIGGER_EPWM_SOCB(n)    (6 + 2 * ((n) - 1))     //ePWMn SOCB, n = 1 - 12
+#define ADC_TRIGGER_MAX             ADC_TRIGGER_EPWM_SOCB(12)
+
+#define ADC_SOC_NUMBER              16
+#define ADC_ACQPS_MIN               14      //75 ns at SYSCLK 200 MHz, the shortest window of 12-bit mode
+#define ADC_ACQPS_MAX               511
+#define ADC_POWERUP_US              1000    //settling of converter after ADCPWDNZ
+#define ADC_SETTLE_CYCLES(mhz)      ((uint32_t)(mhz) * ADC_POWERUP_US)   //SYSCLK cycles of settling at mhz MHz
+
+/**
+ * @brief Numeric representation of converter
+ */
+typedef enum
+{
+  ADC_MIN = -1,             //Not related to ADC, for debug purpose
+
+  ADC_A,                    //AdcaRegs, AdcaResultRegs
+  ADC_B,                    //AdcbRegs, AdcbResultRegs
+  ADC_C,                    //AdccRegs, AdccResultRegs
+  ADC_D,                    //AdcdRegs, AdcdResultRegs
+  ADC_MAX                   //Not related to ADC, for debug purpose
+
+} ADCType;
+
+/**
+ * @brief Interrupt set at end of conversion of SOC. ADCINT1 is at PIE group 1, ADCINT2 - ADCINT4 at group 10.
+ */
+typedef enum
+{
+  ADC_INT_MIN = -1,         //Not related to ADC, for debug purpose
+
+  ADC_INT_NONE,             //end of conversion does not set interrupt
+  ADC_INT1,
+  ADC_INT2,
+  ADC_INT3,
+  ADC_INT4,
+  ADC_INT_MAX               //Not related to ADC, for debug purpose
+
+} ADC_IntType;
+
+/**
+ * @brief Divider of ADCCLK from SYSCLK, ADCCTL2.PRESCALE codes. ADCCLK must be at most 50 MHz.
+ */
+typedef enum
+{
+  ADC_DIV_MIN = -1,         //Not related to ADC, for debug purpose
+
+  ADC_DIV_1_0 = 0,
+  ADC_DIV_2_0 = 2,
+  ADC_DIV_2_5,
+  ADC_DIV_3_0,
+  ADC_DIV_3_5,
+  ADC_DIV_4_0,              //50 MHz at SYSCLK 200 MHz
+  ADC_DIV_4_5,
+  ADC_DIV_5_0,
+  ADC_DIV_5_5,
+  ADC_DIV_6_0,
+  ADC_DIV_6_5,
+  ADC_DIV_7_0,
+  ADC_DIV_7_5,
+  ADC_DIV_8_0,
+  ADC_DIV_8_5,
+  ADC_DIV_MAX               //Not related to ADC, for debug purpose
+
+} ADC_PrescaleType;
+
+/**
+ * @brief Callback called from ISR of ADCINTx, PIE is acknowledged after return
+ */
+typedef void (*ADC_Callback)(ADCType adc, ADC_IntType irq);
+
+/**
+ * @brief Conversion of one SOC
+ */
+typedef struct
+{
+  ADCType adc;              //converter
+  uint16_t soc;             //SOC0 - SOC15, index of result at ADC_RESULT_REGS
+  uint16_t channel;         //input ADCINx, 0 - 15
+  uint16_t trigger;         //ADC_TRIGGER_xxx
+  uint16_t acqps;           //acquisition window is acqps + 1 SYSCLK cycles, ADC_ACQPS_MIN - ADC_ACQPS_MAX
+  ADC_IntType irq;          //interrupt set at end of conversion, one SOC for each ADCINTx of converter
+} ADC_Channel;
+
+/**
+ * @brief Settings of converters
+ */
+typedef struct
+{
+  const ADC_Channel *channels;        //list of SOCs, must be kept until adcReady() returns E_ADC_OK
+  uint16_t number;                    //number of SOCs at list, up to 4 * ADC_SOC_NUMBER
+  ADC_PrescaleType prescale;          //divider of ADCCLK of all converters at list
+  volatile uint32_t *clock;           //free running down counter of SYSCLK cycles, i.e. &CpuTimer2Regs.TIM.all
+  uint32_t settle;                    //SYSCLK cycles of settling, ADC_SETTLE_CYCLES(SYSCLK MHz)
+  ADC_Callback callback;              //called from ISR of every ADCINTx at list, NULL if not used
+} ADC_Cfg;
+
+/**
+ * @brief Statistics of one ADCINTx, updated by ISR
+ */
+typedef struct
+{
+  uint32_t count;                     //number of interrupts
+  uint32_t overflow;                  //interrupts lost because flag was not cleared, ADCINTOVF
+} ADC_Stats;
+
+/**
+ * @brief Function used to configure SOCs of list and to power up their converters. SOCs get software
+ * trigger until adcReady(), converters not used at list are not changed. Settings are copied, so config can
+ * be local variable, only list of SOCs must be kept until adcReady() returns E_ADC_OK.
+ *
+ * @param const ADC_Cfg *config - settings of converters
+ *
+ * @return Status of operation
+ */
+err_adc adcCfg(const ADC_Cfg *config);
+
+/**
+ * @brief Function used to check settling of converters powered up by adcCfg(). When settling time elapsed,
+ * triggers of SOCs are armed and interrupts are enabled.
+ *
+ * @return Status of operation, E_ADC_BUSY if converters are not settled yet
+ */
+err_adc adcReady(void);
+
+/**
+ * @brief Function used to start SOCs by software, ADCSOCFRC1
+ *
+ * @param ADCType adc - converter
+ * @param uint16_t mask - bit n starts SOCn
+ *
+ * @return Status of operation, E_ADC_BUSY if converters are not settled yet
+ */
+err_adc adcForce(ADCType adc, uint16_t mask);
+
+/**
+ * @brief Function used to read result of SOC
+ *
+ * @param ADCType adc - converter
+ * @param uint16_t soc - SOC0 - SOC15
+ * @param uint16_t *value - pointer where result is written
+ *
+ * @return Status of operation
+ */
+err_adc adcRead(ADCType adc, uint16_t soc, uint16_t *value);
+
+/**
+ * @brief Function used to read results of following SOCs, i.e. sequence of one trigger
+ *
+ * @param ADCType adc - converter
+ * @param uint16_t first - the first SOC
+ * @param uint16_t number - number of SOCs
+ * @param uint16_t *values - table where results are written
+ *
+ * @return Status of operation
+ */
+err_adc adcResults(ADCType adc, uint16_t first, uint16_t number, uint16_t *values);
+
+/**
+ * @brief Function used to read statistics of interrupt
+ *
+ * @param ADCType adc - converter
+ * @param ADC_IntType irq - ADC_INT1 - ADC_INT4
+ * @param ADC_Stats *stats - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_adc adcStats(ADCType adc, ADC_IntType irq, ADC_Stats *stats);
+
+#endif /* DRIVERADC_H_ */
@@ -0,0 +1,415 @@
+/**
+ * @file DriverDMA.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of DMA channel driver working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverDMA.h"
+
+#ifdef HOST_SIM
+#define DMA_ADDRESS(pointer)         ((Uint32)(uintptr_t)(pointer))
+#else
+#define DMA_ADDRESS(pointer)         ((Uint32)(pointer))
+#endif
+
+#define DMA_NUMBER                   6
+
+/**
+ * @brief Bits of DMA channel registers
+ */
+#define DMA_MODE_PERINTE             0x0100    //peripheral event starts burst, needed also by PERINTFRC
+#define DMA_MODE_CHINTMODE           0x0200    //channel interrupt at end of transfer
+#define DMA_MODE_DATASIZE            0x4000    //32-bit elements
+#define DMA_MODE_CHINTE              0x8000    //channel interrupt enabled
+#define DMA_MODE_TRANSFER            (DMA_TRANSFER_ONESHOT | DMA_TRANSFER_CONTINUOUS | DMA_TRANSFER_INT_START)
+#define DMA_CONTROL_RUN              0x0001
+#define DMA_CONTROL_HALT             0x0002
+#define DMA_CONTROL_SOFTRESET        0x0004    //transfer stopped by HALT is dropped, not continued by RUN
+#define DMA_CONTROL_PERINTFRC        0x0008
+#define DMA_CONTROL_PERINTCLR        0x0010
+#define DMA_CONTROL_ERRCLR           0x0080
+#define DMA_CONTROL_SYNCERR          0x0400
+#define DMA_CONTROL_RUNSTS           0x2000
+#define DMA_CONTROL_OVRFLG           0x4000
+#define DMA_WRAP_OFF                 0xFFFF    //wrap after 65536 bursts, never at transfer of descriptor
+
+/**
+ * @brief State of one channel
+ */
+typedef struct
+{
+  uint16_t allocated;
+  DMA_Callback callback;           //callback of running transfer, NULL if interrupt is not used by driver
+  DMA_Stats stats;
+} DMA_State;
+
+static __interrupt void DMA_CH1_ISR(void);
+static __interrupt void DMA_CH2_ISR(void);
+static __interrupt void DMA_CH3_ISR(void);
+static __interrupt void DMA_CH4_ISR(void);
+static __interrupt void DMA_CH5_ISR(void);
+static __interrupt void DMA_CH6_ISR(void);
+
+static const PINT DMA_ISR[DMA_NUMBER] =
+{
+  &DMA_CH1_ISR, &DMA_CH2_ISR, &DMA_CH3_ISR, &DMA_CH4_ISR, &DMA_CH5_ISR, &DMA_CH6_ISR
+};
+
+//order of dmaAlloc(), CH1 is the last because only it has high priority mode
+static const DMA_ChannelType DMA_ALLOC_ORDER[DMA_NUMBER] =
+{
+  DMA_CH2, DMA_CH3, DMA_CH4, DMA_CH5, DMA_CH6, DMA_CH1
+};
+
+static DMA_State dmaState[DMA_NUMBER];
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static volatile struct CH_REGS* DMA_REGS(DMA_ChannelType channel)
+{
+  return &DmaRegs.CH1 + channel;
+}
+
+static err_dma DMA_CHECK(DMA_ChannelType channel)
+{
+  if((uint32_t)channel >= DMA_NUMBER)
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  return dmaState[channel].allocated ? E_DMA_OK : E_DMA_NOT_INITIALIZE;
+}
+
+/**
+ * @brief Static function used to count and clear error flags of channel. Must be called with EALLOW.
+ */
+static void DMA_ERRORS(volatile struct CH_REGS *regs, DMA_State *state)
+{
+  uint16_t control = regs->CONTROL.all;
+
+  if(control & (DMA_CONTROL_OVRFLG | DMA_CONTROL_SYNCERR))
+  {
+    regs->CONTROL.all = DMA_CONTROL_ERRCLR;
+    state->stats.overflow += (control & DMA_CONTROL_OVRFLG) ? 1 : 0;
+    state->stats.syncError += (control & DMA_CONTROL_SYNCERR) ? 1 : 0;
+  }
+}
+
+/**
+ * @brief Static function shared by ISR of all channels
+ */
+static inline void DMA_DISPATCH(DMA_ChannelType channel)
+{
+  DMA_State *state = &dmaState[channel];
+
+  state->stats.transfers++;
+
+  EALLOW;
+  DMA_ERRORS(DMA_REGS(channel), state);
+  EDIS;
+
+  if(state->callback != NULL)
+  {
+    state->callback(channel);
+  }
+
+  PieCtrlRegs.PIEACK.all = M_INT7;
+}
+
+static __interrupt void DMA_CH1_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH1);
+}
+
+static __interrupt void DMA_CH2_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH2);
+}
+
+static __interrupt void DMA_CH3_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH3);
+}
+
+static __interrupt void DMA_CH4_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH4);
+}
+
+static __interrupt void DMA_CH5_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH5);
+}
+
+static __interrupt void DMA_CH6_ISR(void)
+{
+  DMA_DISPATCH(DMA_CH6);
+}
+
+/**
+ * @brief Static function used to take channel, clock of DMA is enabled and DMA runs at emulation halt
+ */
+static void DMA_TAKE(DMA_ChannelType channel)
+{
+  EALLOW;
+  CpuSysRegs.PCLKCR0.bit.DMA = 1;
+  DmaRegs.DEBUGCTRL.bit.FREE = 1;
+  EDIS;
+
+  dmaState[channel].allocated = 1;
+  dmaState[channel].callback = NULL;
+}
+
+/**
+ * @brief Static function used to validate descriptor
+ */
+static err_dma DMA_CHECK_TRANSFER(const DMA_Transfer *transfer)
+{
+  uint16_t words = 0;
+
+  if((transfer == NULL) || (transfer->source == NULL) || (transfer->destination == NULL) ||
+     ((uint32_t)transfer->size >= DMA_SIZE_MAX))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  words = (transfer->size == DMA_SIZE_32) ? 2 : 1;
+
+  if((transfer->burst == 0) || ((uint32_t)transfer->burst * words > DMA_BURST_MAX) || (transfer->transfers == 0) ||
+     (transfer->trigger > 0xFF) || ((transfer->mode & ~DMA_MODE_TRANSFER) != 0))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  return E_DMA_OK;
+}
+
+/**
+ * @brief Static function used to select trigger of channel, 4 channels at DMACHSRCSEL1, 2 at DMACHSRCSEL2,
+ * 8 bits for each. Must be called with EALLOW.
+ */
+static void DMA_TRIGGER(DMA_ChannelType channel, uint16_t trigger)
+{
+  volatile Uint32 *select = &DmaClaSrcSelRegs.DMACHSRCSEL1.all + channel / 4;
+
+  *select = (*select & ~(0xFFUL << (8 * (channel % 4)))) | ((Uint32)trigger << (8 * (channel % 4)));
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_dma dmaAlloc(DMA_ChannelType *channel)
+{
+  uint16_t i = 0;
+
+  if(channel == NULL)
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  for(i = 0; i < DMA_NUMBER; i++)
+  {
+    if(!dmaState[DMA_ALLOC_ORDER[i]].allocated)
+    {
+      DMA_TAKE(DMA_ALLOC_ORDER[i]);
+      *channel = DMA_ALLOC_ORDER[i];
+      return E_DMA_OK;
+    }
+  }
+
+  return E_DMA_NO_CHANNEL;
+}
+
+err_dma dmaClaim(DMA_ChannelType channel)
+{
+  err_dma ret = E_DMA_OK;
+
+  if((uint32_t)channel >= DMA_NUMBER)
+  {
+    ret = E_DMA_INVALID_PARAM;
+  }
+  else if(dmaState[channel].allocated)
+  {
+    ret = E_DMA_BUSY;
+  }
+  else
+  {
+    DMA_TAKE(channel);
+  }
+
+  return ret;
+}
+
+err_dma dmaFree(DMA_ChannelType channel)
+{
+  err_dma ret = dmaStop(channel);
+
+  if(ret == E_DMA_OK)
+  {
+    dmaState[channel].allocated = 0;
+  }
+
+  return ret;
+}
+
+err_dma dmaStart(DMA_ChannelType channel, const DMA_Transfer *transfer)
+{
+  err_dma ret = DMA_CHECK(channel);
+  volatile struct CH_REGS *regs = NULL;
+  DMA_State *state = NULL;
+  uint16_t words = 0;
+  uint16_t mode = 0;
+
+  if(ret != E_DMA_OK)
+  {
+    return ret;
+  }
+
+  if(DMA_CHECK_TRANSFER(transfer) != E_DMA_OK)
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  if(dmaBusy(channel))
+  {
+    return E_DMA_BUSY;
+  }
+
+  regs = DMA_REGS(channel);
+  state = &dmaState[channel];
+  words = (transfer->size == DMA_SIZE_32) ? 2 : 1;
+
+  //interrupt at end of transfer is default, DMA_TRANSFER_INT_START clears CHINTMODE
+  mode = DMA_MODE_PERINTE | (channel + 1) | (transfer->mode & (DMA_TRANSFER_ONESHOT | DMA_TRANSFER_CONTINUOUS)) |
+         ((transfer->mode & DMA_TRANSFER_INT_START) ? 0 : DMA_MODE_CHINTMODE) |
+         ((transfer->size == DMA_SIZE_32) ? DMA_MODE_DATASIZE : 0) | ((transfer->callback != NULL) ? DMA_MODE_CHINTE : 0);
+
+  state->callback = transfer->callback;
+
+  //sizes of registers are in 16-bit words, steps of descriptor are in elements
+  EALLOW;
+  regs->CONTROL.all = DMA_CONTROL_HALT | DMA_CONTROL_SOFTRESET;
+  regs->MODE.all = mode;
+  regs->BURST_SIZE.all = transfer->burst * words - 1;
+  regs->SRC_BURST_STEP = transfer->srcBurstStep * (int16_t)words;
+  regs->DST_BURST_STEP = transfer->dstBurstStep * (int16_t)words;
+  regs->TRANSFER_SIZE = transfer->transfers - 1;
+  regs->SRC_TRANSFER_STEP = transfer->srcTransferStep * (int16_t)words;
+  regs->DST_TRANSFER_STEP = transfer->dstTransferStep * (int16_t)words;
+  regs->SRC_WRAP_SIZE = (transfer->srcWrap != DMA_WRAP_NONE) ? (transfer->srcWrap - 1) : DMA_WRAP_OFF;
+  regs->SRC_WRAP_STEP = transfer->srcWrapStep * (int16_t)words;
+  regs->DST_WRAP_SIZE = (transfer->dstWrap != DMA_WRAP_NONE) ? (transfer->dstWrap - 1) : DMA_WRAP_OFF;
+  regs->DST_WRAP_STEP = transfer->dstWrapStep * (int16_t)words;
+  regs->SRC_BEG_ADDR_SHADOW = DMA_ADDRESS(transfer->source);
+  regs->SRC_ADDR_SHADOW = DMA_ADDRESS(transfer->source);
+  regs->DST_BEG_ADDR_SHADOW = DMA_ADDRESS(transfer->destination);
+  regs->DST_ADDR_SHADOW = DMA_ADDRESS(transfer->destination);
+  DMA_TRIGGER(channel, transfer->trigger);
+  regs->CONTROL.all = DMA_CONTROL_PERINTCLR | DMA_CONTROL_ERRCLR;
+
+  if(transfer->callback != NULL)
+  {
+    *(&PieVectTable.DMA_CH1_INT + channel) = DMA_ISR[channel];
+  }
+  EDIS;
+
+  if(transfer->callback != NULL)
+  {
+    PieCtrlRegs.PIEIER7.all |= 1U << channel;
+    IER |= M_INT7;
+  }
+
+  EALLOW;
+  regs->CONTROL.all = DMA_CONTROL_RUN;
+  EDIS;
+
+  return E_DMA_OK;
+}
+
+err_dma dmaNextDestination(DMA_ChannelType channel, volatile void *destination)
+{
+  err_dma ret = DMA_CHECK(channel);
+  volatile struct CH_REGS *regs = NULL;
+
+  if((ret == E_DMA_OK) && (destination == NULL))
+  {
+    ret = E_DMA_INVALID_PARAM;
+  }
+
+  if(ret == E_DMA_OK)
+  {
+    regs = DMA_REGS(channel);
+
+    EALLOW;
+    regs->DST_BEG_ADDR_SHADOW = DMA_ADDRESS(destination);
+    regs->DST_ADDR_SHADOW = DMA_ADDRESS(destination);
+    EDIS;
+  }
+
+  return ret;
+}
+
+err_dma dmaForce(DMA_ChannelType channel)
+{
+  err_dma ret = DMA_CHECK(channel);
+
+  if(ret == E_DMA_OK)
+  {
+    EALLOW;
+    DMA_REGS(channel)->CONTROL.all = DMA_CONTROL_PERINTFRC;
+    EDIS;
+  }
+
+  return ret;
+}
+
+err_dma dmaStop(DMA_ChannelType channel)
+{
+  err_dma ret = DMA_CHECK(channel);
+  DMA_State *state = NULL;
+
+  if(ret == E_DMA_OK)
+  {
+    state = &dmaState[channel];
+
+    EALLOW;
+    DMA_REGS(channel)->CONTROL.all = DMA_CONTROL_HALT | DMA_CONTROL_SOFTRESET;
+    EDIS;
+
+    //interrupt of channel is disabled only if it was enabled by driver
+    if(state->callback != NULL)
+    {
+      PieCtrlRegs.PIEIER7.all &= ~(1U << channel);
+      state->callback = NULL;
+    }
+  }
+
+  return ret;
+}
+
+uint16_t dmaBusy(DMA_ChannelType channel)
+{
+  if((uint32_t)channel >= DMA_NUMBER)
+  {
+    return 0;
+  }
+
+  return (DMA_REGS(channel)->CONTROL.all & DMA_CONTROL_RUNSTS) ? 1 : 0;
+}
+
+err_dma dmaStats(DMA_ChannelType channel, DMA_Stats *stats)
+{
+  if(((uint32_t)channel >= DMA_NUMBER) || (stats == NULL))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  EALLOW;
+  DMA_ERRORS(DMA_REGS(channel), &dmaState[channel]);
+  EDIS;
+
+  *stats = dmaState[channel].stats;
+  return E_DMA_OK;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file DriverDMA.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of DMA channel driver. Channel is allocated by dmaAlloc() or dmaClaim() and programmed
+ * from transfer descriptor, which keeps geometry of transfer (burst, transfer, wrap), trigger and mode.
+ * End of transfer is reported by callback called from ISR of channel (DMA_CH1_INT - DMA_CH6_INT).
+ * Channels used by other drivers (i.e SPI, scheduler) are allocated by these drivers, so they are not
+ * allocated twice.
+ *
+ *   static const DMA_Transfer copy =
+ *   {
+ *     source, destination,        //buffs at GS RAM
+ *     16, 1, 1,                   //burst of 16 words, step 1
+ *     8, 1, 1,                    //8 bursts, step 1 after burst
+ *     0, 0, 0, 0,                 //no wrap
+ *     DMA_TRIGGER_SOFTWARE, DMA_SIZE_16, DMA_TRANSFER_ONESHOT, copyDone
+ *   };
+ *
+ *   dmaAlloc(&channel);
+ *   dmaStart(channel, &copy);
+ *   dmaForce(channel);                                        //the whole transfer at one event
+ */
+
+#ifndef DRIVERDMA_H_
+#define DRIVERDMA_H_
+
+#include <stdint.h>
+
+typedef int err_dma;
+
+/**
+ * @brief Numeric representation of DMA error
+ */
+#define E_DMA_OK                    0     //Operation successful
+#define E_DMA_INVALID_PARAM        -1     //Invalid parameters of transfer
+#define E_DMA_NOT_INITIALIZE       -2     //Channel is not allocated
+#define E_DMA_BUSY                 -3     //Channel is allocated or transfer is not finished
+#define E_DMA_NO_CHANNEL           -4     //All channels are allocated
+#define E_DMA_EMPTY                -5     //No buffer is ready, see DriverDMABuffer.h
+#define E_DMA_OVERLOAD             -6     //Streams can not meet their deadlines, see DriverDMASched.h
+
+/**
+ * @brief Triggers of channel, DMACHSRCSEL codes. Other peripherals are at F2837xS TRM, table of DMA trigger
+ * sources.
+ */
+#define DMA_TRIGGER_SOFTWARE        0                       //only dmaForce() (PERINTFRC)
+#define DMA_TRIGGER_ADCA(n)         (0 + (n))               //ADCAINTn, n = 1 - 4
+#define DMA_TRIGGER_ADCA_EVT        5
+#define DMA_TRIGGER_XINT(n)         (28 + (n))              //XINTn, n = 1 - 5
+#define DMA_TRIGGER_EPWM_SOCA(n)    (36 + 2 * ((n) - 1))    //ePWMn SOCA, n = 1 - 12
+#define DMA_TRIGGER_EPWM_SOCB(n)    (37 + 2 * ((n) - 1))    //ePWMn SOCB, n = 1 - 12
+#define DMA_TRIGGER_TINT(n)         (68 + (n))              //CPU timer n, n = 0 - 2
+#define DMA_TRIGGER_MCBSPA_TX       71
+#define DMA_TRIGGER_MCBSPA_RX       72
+#define DMA_TRIGGER_MCBSPB_TX       73
+#define DMA_TRIGGER_MCBSPB_RX       74
+#define DMA_TRIGGER_SPI_TX(n)       (109 + 2 * (n))         //SPITXDMA of SPI_A - SPI_C, n = 0 - 2
+#define DMA_TRIGGER_SPI_RX(n)       (110 + 2 * (n))         //SPIRXDMA of SPI_A - SPI_C, n = 0 - 2
+
+#define DMA_BURST_MAX               32                      //16-bit words of burst
+#define DMA_WRAP_NONE               0                       //wrap of descriptor is not used
+
+/**
+ * @brief Numeric representation of DMA channel
+ */
+typedef enum
+{
+  DMA_CH_MIN = -1,          //Not related to DMA, for debug purpose
+
+  DMA_CH1,                  //PIE 7.1, high priority mode (PRIORITYCTRL1.CH1PRIORITY)
+  DMA_CH2,                  //PIE 7.2
+  DMA_CH3,                  //PIE 7.3
+  DMA_CH4,                  //PIE 7.4
+  DMA_CH5,                  //PIE 7.5
+  DMA_CH6,                  //PIE 7.6
+  DMA_CH_MAX                //Not related to DMA, for debug purpose
+
+} DMA_ChannelType;
+
+/**
+ * @brief Size of element moved by DMA (MODE.DATASIZE)
+ */
+typedef enum
+{
+  DMA_SIZE_MIN = -1,        //Not related to DMA, for debug purpose
+
+  DMA_SIZE_16,              //16-bit words
+  DMA_SIZE_32,              //32-bit words, addresses must be even
+  DMA_SIZE_MAX              //Not related to DMA, for debug purpose
+
+} DMA_SizeType;
+
+/**
+ * @brief Mode of transfer, bits of MODE register, can be ORed
+ */
+typedef enum
+{
+  DMA_TRANSFER_BURST = 0x0000,        //one burst at each trigger event
+  DMA_TRANSFER_ONESHOT = 0x0400,      //the whole transfer at one trigger event
+  DMA_TRANSFER_CONTINUOUS = 0x0800,   //transfer is started again after end, addresses are loaded from shadow
+  DMA_TRANSFER_INT_START = 0x0200     //callback at start of transfer instead of end (CHINTMODE cleared)
+
+} DMA_TransferMode;
+
+/**
+ * @brief Callback called from ISR of channel at end of transfer, PIE is acknowledged after return
+ */
+typedef void (*DMA_Callback)(DMA_ChannelType channel);
+
+/**
+ * @brief Descriptor of transfer. Sizes and steps are in elements of size, so the same descriptor works for
+ * 16-bit and 32-bit data. Source and destination must be at memory accessible by DMA (GS RAM, peripheral frames).
+ */
+typedef struct
+{
+  const volatile void *source;
+  volatile void *destination;
+  uint16_t burst;           //elements of burst, up to DMA_BURST_MAX words
+  int16_t srcBurstStep;     //step between elements of burst
+  int16_t dstBurstStep;
+  uint16_t transfers;       //bursts of transfer
+  int16_t srcTransferStep;  //step from the last element of burst to the first element of the next burst
+  int16_t dstTransferStep;
+  uint16_t srcWrap;         //bursts after which source is moved to its begin + srcWrapStep, DMA_WRAP_NONE
+  int16_t srcWrapStep;
+  uint16_t dstWrap;         //bursts after which destination is moved to its begin + dstWrapStep, DMA_WRAP_NONE
+  int16_t dstWrapStep;
+  uint16_t trigger;         //DMA_TRIGGER_..., DMA_TRIGGER_SOFTWARE if started only by dmaForce()
+  DMA_SizeType size;
+  uint16_t mode;            //DMA_TransferMode
+  DMA_Callback callback;    //called from ISR, NULL - interrupt of channel is disabled
+} DMA_Transfer;
+
+/**
+ * @brief Statistics of channel, errors are counted by ISR of channel and by dmaStats()
+ */
+typedef struct
+{
+  uint32_t transfers;       //number of interrupts of channel
+  uint32_t overflow;        //OVRFLG, trigger event came when previous one was not served
+  uint32_t syncError;       //SYNCERR, ADC sync event came at the middle of burst
+} DMA_Stats;
+
+/**
+ * @brief Function used to allocate free channel. Channels are taken from DMA_CH2 up, DMA_CH1 is given as the
+ * last one because only it has high priority mode.
+ *
+ * @param DMA_ChannelType *channel - pointer where allocated channel is written
+ *
+ * @return Status of operation, E_DMA_NO_CHANNEL if all channels are allocated
+ */
+err_dma dmaAlloc(DMA_ChannelType *channel);
+
+/**
+ * @brief Function used to allocate given channel, i.e DMA_CH1 with high priority mode by scheduler
+ *
+ * @param DMA_ChannelType channel - channel of DMA
+ *
+ * @return Status of operation, E_DMA_BUSY if channel is already allocated
+ */
+err_dma dmaClaim(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to stop channel, disable its interrupt and return it to free channels
+ *
+ * @param DMA_ChannelType channel - allocated channel
+ *
+ * @return Status of operation
+ */
+err_dma dmaFree(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to program channel from descriptor and start it. Transfer waits for trigger events,
+ * at DMA_TRIGGER_SOFTWARE events are made by dmaForce().
+ *
+ * @param DMA_ChannelType channel - allocated channel
+ * @param const DMA_Transfer *transfer - descriptor of transfer, buffs must be kept until end of transfer
+ *
+ * @return Status of operation, E_DMA_BUSY if previous transfer is running
+ */
+err_dma dmaStart(DMA_ChannelType channel, const DMA_Transfer *transfer);
+
+/**
+ * @brief Function used to set destination of the next transfer (shadow registers). Active transfer is not
+ * changed, in continuous mode shadow is loaded at start of the next transfer. Can be called from callback
+ * at start of transfer (DMA_TRANSFER_INT_START).
+ *
+ * @param DMA_ChannelType channel - allocated channel
+ * @param volatile void *destination - destination of the next transfer
+ *
+ * @return Status of operation
+ */
+err_dma dmaNextDestination(DMA_ChannelType channel, volatile void *destination);
+
+/**
+ * @brief Function used to make trigger event by software (PERINTFRC)
+ *
+ * @param DMA_ChannelType channel - allocated channel
+ *
+ * @return Status of operation
+ */
+err_dma dmaForce(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to stop transfer, the rest of transfer is dropped
+ *
+ * @param DMA_ChannelType channel - allocated channel
+ *
+ * @return Status of operation
+ */
+err_dma dmaStop(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to check if channel is running. Continuous transfer is running until dmaStop().
+ *
+ * @param DMA_ChannelType channel - channel of DMA
+ *
+ * @return 1 - channel is running, 0 - channel is stopped
+ */
+uint16_t dmaBusy(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to read statistics of channel. Error flags of channel are counted and cleared.
+ *
+ * @param DMA_ChannelType channel - channel of DMA
+ * @param DMA_Stats *stats - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_dma dmaStats(DMA_ChannelType channel, DMA_Stats *stats);
+
+#endif /* DRIVERDMA_H_ */
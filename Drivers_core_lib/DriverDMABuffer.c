@@ -0,0 +1,219 @@
+/**
+ * @file DriverDMABuffer.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of DMA N-buffer manager working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverDMABuffer.h"
+
+#define DMA_BUFFER_NUMBER     6
+#define DMA_BUFFER_DEPTH_MIN  3
+
+/**
+ * @brief Stream of one channel. Counters of queue are free running, head is changed only by ISR and tail
+ * only by application. Published buffers are the head - tail buffers before the one filled by DMA.
+ */
+typedef struct
+{
+  uint16_t running;
+  volatile uint16_t *pool;
+  uint16_t length;
+  uint16_t depth;
+  DMA_BufferCallback callback;
+  uint16_t started;                //the first transfer is started
+  uint16_t filling;                //buffer filled by DMA, changed only by ISR
+  uint16_t shadow;                 //buffer of the next transfer
+  volatile uint16_t head;          //buffers published
+  volatile uint16_t tail;          //buffers released
+  uint16_t read;                   //the oldest published buffer, changed only by application
+  DMA_BufferStats stats;
+} DMA_Buffer;
+
+static DMA_Buffer dmaBuffers[DMA_BUFFER_NUMBER];
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static uint16_t DMA_BUFFER_NEXT(const DMA_Buffer *stream, uint16_t index)
+{
+  return (index + 1 < stream->depth) ? (index + 1) : 0;
+}
+
+static DMA_Buffer* DMA_BUFFER_RUNNING(DMA_ChannelType channel)
+{
+  if(((uint32_t)channel >= DMA_BUFFER_NUMBER) || !dmaBuffers[channel].running)
+  {
+    return NULL;
+  }
+
+  return &dmaBuffers[channel];
+}
+
+/**
+ * @brief Static function called by ISR of DMA at start of every transfer. DMA copied shadow address to
+ * active one, so buffer filled by previous transfer is complete. Shadow is moved to the next buffer only if
+ * it is not held by application.
+ */
+static void DMA_BUFFER_ISR(DMA_ChannelType channel)
+{
+  DMA_Buffer *stream = &dmaBuffers[channel];
+  uint16_t ready = stream->filling;
+  uint16_t next = 0;
+
+  if(!stream->started)
+  {
+    stream->started = 1;
+  }
+  else if(stream->shadow != ready)
+  {
+    stream->filling = stream->shadow;
+    stream->head++;
+    stream->stats.published++;
+    if(stream->callback != NULL)
+    {
+      stream->callback(channel, ready);
+    }
+  }
+  else
+  {
+    stream->stats.dropped++;
+  }
+
+  //buffer after the filled one is free if application holds less than depth - 1 buffers
+  next = ((uint16_t)(stream->head - stream->tail) + 2 <= stream->depth) ? DMA_BUFFER_NEXT(stream, stream->filling) :
+                                                                           stream->filling;
+  if(next != stream->shadow)
+  {
+    dmaNextDestination(channel, stream->pool + (uint32_t)next * stream->length);
+    stream->shadow = next;
+  }
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_dma dmaBufferStart(DMA_ChannelType channel, const DMA_BufferCfg *config)
+{
+  err_dma ret = E_DMA_OK;
+  DMA_Buffer *stream = NULL;
+  DMA_Transfer transfer;
+  uint32_t words = 0;
+
+  if(((uint32_t)channel >= DMA_BUFFER_NUMBER) || (config == NULL) || (config->transfer == NULL) ||
+     (config->pool == NULL) || (config->length == 0) || (config->depth < DMA_BUFFER_DEPTH_MIN))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  //one transfer must fill exactly one buffer, else DMA writes over the next buffer or leaves a gap
+  words = (uint32_t)config->transfer->burst * config->transfer->transfers *
+          ((config->transfer->size == DMA_SIZE_32) ? 2 : 1);
+  if(words != config->length)
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  stream = &dmaBuffers[channel];
+  if(stream->running)
+  {
+    return E_DMA_BUSY;
+  }
+
+  stream->pool = (volatile uint16_t *)config->pool;
+  stream->length = config->length;
+  stream->depth = config->depth;
+  stream->callback = config->callback;
+  stream->started = 0;
+  stream->filling = 0;
+  stream->shadow = 0;
+  stream->head = 0;
+  stream->tail = 0;
+  stream->read = 0;
+  stream->stats.published = 0;
+  stream->stats.dropped = 0;
+
+  //the first transfer fills the first buffer
+  transfer = *config->transfer;
+  transfer.destination = config->pool;
+  transfer.mode = (transfer.mode & DMA_TRANSFER_ONESHOT) | DMA_TRANSFER_CONTINUOUS | DMA_TRANSFER_INT_START;
+  transfer.callback = DMA_BUFFER_ISR;
+
+  ret = dmaStart(channel, &transfer);
+  stream->running = (ret == E_DMA_OK) ? 1 : 0;
+
+  return ret;
+}
+
+err_dma dmaBufferGet(DMA_ChannelType channel, uint16_t *index, void **buffer)
+{
+  DMA_Buffer *stream = DMA_BUFFER_RUNNING(channel);
+
+  if((stream == NULL) || (index == NULL))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  if(stream->head == stream->tail)
+  {
+    return E_DMA_EMPTY;
+  }
+
+  *index = stream->read;
+  if(buffer != NULL)
+  {
+    *buffer = (void *)(stream->pool + (uint32_t)stream->read * stream->length);
+  }
+
+  return E_DMA_OK;
+}
+
+err_dma dmaBufferRelease(DMA_ChannelType channel)
+{
+  DMA_Buffer *stream = DMA_BUFFER_RUNNING(channel);
+
+  if(stream == NULL)
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  if(stream->head == stream->tail)
+  {
+    return E_DMA_EMPTY;
+  }
+
+  //index is moved before buffer is given back to ISR
+  stream->read = DMA_BUFFER_NEXT(stream, stream->read);
+  stream->tail++;
+
+  return E_DMA_OK;
+}
+
+err_dma dmaBufferStop(DMA_ChannelType channel)
+{
+  err_dma ret = E_DMA_OK;
+  DMA_Buffer *stream = DMA_BUFFER_RUNNING(channel);
+
+  if(stream == NULL)
+  {
+    ret = E_DMA_INVALID_PARAM;
+  }
+  else
+  {
+    ret = dmaStop(channel);
+    stream->running = 0;
+  }
+
+  return ret;
+}
+
+err_dma dmaBufferStats(DMA_ChannelType channel, DMA_BufferStats *stats)
+{
+  if(((uint32_t)channel >= DMA_BUFFER_NUMBER) || (stats == NULL))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  *stats = dmaBuffers[channel].stats;
+  return E_DMA_OK;
+}
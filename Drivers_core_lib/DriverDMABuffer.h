@@ -0,0 +1,119 @@
+/**
+ * @file DriverDMABuffer.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of DMA N-buffer manager for continuous streams (ADC results, McBSP, SPI slave). DMA
+ * fills pool of depth buffers one transfer after another. At start of every transfer ISR of channel
+ * publishes the buffer filled by previous transfer and writes shadow address of the next free buffer, so
+ * buffer owned by application is never overwritten. If there is no free buffer, the buffer being filled is
+ * filled again by the next transfer and it is counted as dropped. Ready buffers are published by
+ * single-producer/single-consumer queue, so processing loop runs at block rate without locks.
+ *
+ *   static const DMA_Transfer adcBlock =
+ *   {
+ *     &AdcaResultRegs.ADCRESULT0, NULL,   //destination is taken from pool
+ *     1, 0, 0,                            //burst of one result
+ *     64, 0, 1,                           //64 results of one buffer
+ *     0, 0, 0, 0,
+ *     DMA_TRIGGER_ADCA(1), DMA_SIZE_16, DMA_TRANSFER_BURST, NULL
+ *   };
+ *   static const DMA_BufferCfg adcStream = { &adcBlock, adcPool, 64, 4, NULL };
+ *
+ *   dmaAlloc(&channel);
+ *   dmaBufferStart(channel, &adcStream);
+ *   ...
+ *   if(dmaBufferGet(channel, &index, &block) == E_DMA_OK)
+ *   {
+ *     process(block);
+ *     dmaBufferRelease(channel);
+ *   }
+ */
+
+#ifndef DRIVERDMABUFFER_H_
+#define DRIVERDMABUFFER_H_
+
+#include <stdint.h>
+#include "DriverDMA.h"
+
+/**
+ * @brief Callback called from ISR of channel when buffer is published
+ */
+typedef void (*DMA_BufferCallback)(DMA_ChannelType channel, uint16_t index);
+
+/**
+ * @brief Settings of stream
+ */
+typedef struct
+{
+  const DMA_Transfer *transfer;   //one transfer fills one buffer. Destination, mode and callback are not used
+  volatile void *pool;            //depth buffers one after another, at GS RAM
+  uint16_t length;                //16-bit words of one buffer, distance between buffers at pool
+  uint16_t depth;                 //at least 3: filled by DMA, armed at shadow, application holds depth - 2
+  DMA_BufferCallback callback;    //called from ISR when buffer is ready, NULL if not used
+} DMA_BufferCfg;
+
+/**
+ * @brief Statistics of stream
+ */
+typedef struct
+{
+  uint32_t published;             //buffers published to queue
+  uint32_t dropped;               //buffers filled again because application held all other buffers
+} DMA_BufferStats;
+
+/**
+ * @brief Function used to start stream at allocated channel. Transfer of descriptor is run in continuous
+ * mode with interrupt at start of transfer, the first buffer of pool is filled as first. One transfer must
+ * fill exactly one buffer (burst * transfers elements equal to length words). Statistics are cleared.
+ *
+ * @param DMA_ChannelType channel - channel allocated by dmaAlloc()
+ * @param const DMA_BufferCfg *config - settings of stream, pool must be kept until dmaBufferStop()
+ *
+ * @return Status of operation
+ */
+err_dma dmaBufferStart(DMA_ChannelType channel, const DMA_BufferCfg *config);
+
+/**
+ * @brief Function used to get the oldest ready buffer. Buffer is owned by application until
+ * dmaBufferRelease(). Must be called only by one consumer.
+ *
+ * @param DMA_ChannelType channel - channel of stream
+ * @param uint16_t *index - pointer where index of buffer at pool is written
+ * @param void **buffer - pointer where address of buffer is written, can be NULL
+ *
+ * @return Status of operation, E_DMA_EMPTY if no buffer is ready
+ */
+err_dma dmaBufferGet(DMA_ChannelType channel, uint16_t *index, void **buffer);
+
+/**
+ * @brief Function used to return buffer got by dmaBufferGet(). Buffer can be filled again from the next
+ * transfer after the one which is running.
+ *
+ * @param DMA_ChannelType channel - channel of stream
+ *
+ * @return Status of operation, E_DMA_EMPTY if no buffer is held
+ */
+err_dma dmaBufferRelease(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to stop stream, buffer being filled is dropped. Channel stays allocated.
+ *
+ * @param DMA_ChannelType channel - channel of stream
+ *
+ * @return Status of operation
+ */
+err_dma dmaBufferStop(DMA_ChannelType channel);
+
+/**
+ * @brief Function used to read statistics of stream
+ *
+ * @param DMA_ChannelType channel - channel of stream
+ * @param DMA_BufferStats *stats - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_dma dmaBufferStats(DMA_ChannelType channel, DMA_BufferStats *stats);
+
+#endif /* DRIVERDMABUFFER_H_ */
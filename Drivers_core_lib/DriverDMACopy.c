@@ -0,0 +1,220 @@
+/**
+ * @file DriverDMACopy.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of DMA memory copy and fill engine working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverDMACopy.h"
+
+//32-bit word of DMA is at even address of 16-bit words, at host at address aligned to 4 bytes
+#ifdef HOST_SIM
+#define DMA_COPY_ALIGNED(pointer)    ((((uintptr_t)(pointer)) & 3) == 0)
+#else
+#define DMA_COPY_ALIGNED(pointer)    ((((Uint32)(pointer)) & 1) == 0)
+#endif
+
+#define DMA_COPY_TRANSFERS_MAX       0xFFFF    //bursts of one transfer
+
+/**
+ * @brief State of move, the rest of block is moved by next transfers started from ISR
+ */
+typedef struct
+{
+  volatile uint16_t busy;
+  volatile err_dma status;             //E_DMA_BUSY while block is moved, result of the last move after it
+  volatile uint16_t *destination;      //begin of the next transfer
+  const volatile uint16_t *source;
+  uint32_t left;                       //elements not moved yet
+  DMA_SizeType size;
+  uint16_t fill;                       //source is pattern, not moved
+  DMA_Callback callback;
+} DMA_CopyState;
+
+static DMA_ChannelType dmaCopyChannel = DMA_CH_MIN;
+static DMA_CopyState dmaCopyState;
+
+//DMA can access only GS RAM
+#pragma DATA_SECTION(dmaCopyPattern, "ramgs_dma")
+static uint32_t dmaCopyPattern;        //source of fill, the same value at both 16-bit halves
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static void DMA_COPY_ISR(DMA_ChannelType channel);
+
+/**
+ * @brief Static function used to start the next transfer of block. Transfer is made of full bursts, the rest
+ * shorter than burst is moved by the last transfer with one burst. Move is finished with error status if
+ * channel can not be started.
+ */
+static err_dma DMA_COPY_NEXT(void)
+{
+  err_dma ret = E_DMA_OK;
+  DMA_CopyState *state = &dmaCopyState;
+  DMA_Transfer transfer;
+  uint16_t words = (state->size == DMA_SIZE_32) ? 2 : 1;
+  uint16_t burst = DMA_BURST_MAX / words;
+  uint32_t elements = state->left;
+  int16_t step = state->fill ? 0 : 1;
+
+  if(elements >= burst)
+  {
+    if(elements > (uint32_t)burst * DMA_COPY_TRANSFERS_MAX)
+    {
+      elements = (uint32_t)burst * DMA_COPY_TRANSFERS_MAX;
+    }
+    transfer.burst = burst;
+    transfer.transfers = (uint16_t)(elements / burst);
+    elements = (uint32_t)transfer.transfers * burst;
+  }
+  else
+  {
+    transfer.burst = (uint16_t)elements;
+    transfer.transfers = 1;
+  }
+
+  transfer.source = state->source;
+  transfer.destination = state->destination;
+  transfer.srcBurstStep = step;
+  transfer.dstBurstStep = 1;
+  transfer.srcTransferStep = step;
+  transfer.dstTransferStep = 1;
+  transfer.srcWrap = DMA_WRAP_NONE;
+  transfer.srcWrapStep = 0;
+  transfer.dstWrap = DMA_WRAP_NONE;
+  transfer.dstWrapStep = 0;
+  transfer.trigger = DMA_TRIGGER_SOFTWARE;
+  transfer.size = state->size;
+  transfer.mode = DMA_TRANSFER_ONESHOT;
+  transfer.callback = DMA_COPY_ISR;
+
+  state->left -= elements;
+  state->destination += elements * words;
+  if(!state->fill)
+  {
+    state->source += elements * words;
+  }
+
+  //the whole transfer is moved at one software event
+  ret = dmaStart(dmaCopyChannel, &transfer);
+  if(ret == E_DMA_OK)
+  {
+    ret = dmaForce(dmaCopyChannel);
+  }
+
+  if(ret != E_DMA_OK)
+  {
+    state->status = ret;
+    state->busy = 0;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Static function called by ISR of DMA at the end of transfer
+ */
+static void DMA_COPY_ISR(DMA_ChannelType channel)
+{
+  DMA_CopyState *state = &dmaCopyState;
+
+  if(state->left > 0)
+  {
+    //move is finished by error, application reads it by dmaCopyStatus() from callback
+    if((DMA_COPY_NEXT() != E_DMA_OK) && (state->callback != NULL))
+    {
+      state->callback(channel);
+    }
+  }
+  else
+  {
+    state->status = E_DMA_OK;
+    state->busy = 0;
+    if(state->callback != NULL)
+    {
+      state->callback(channel);
+    }
+  }
+}
+
+static err_dma DMA_COPY_START(volatile void *destination, const volatile void *source, uint32_t length, uint16_t fill,
+                              DMA_Callback callback)
+{
+  DMA_CopyState *state = &dmaCopyState;
+  uint16_t wide = 0;
+
+  if(dmaCopyChannel == DMA_CH_MIN)
+  {
+    return E_DMA_NOT_INITIALIZE;
+  }
+
+  if((destination == NULL) || (source == NULL) || (length == 0))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  if(state->busy)
+  {
+    return E_DMA_BUSY;
+  }
+
+  //32-bit words halve number of DMA reads and writes
+  wide = ((length % 2) == 0) && DMA_COPY_ALIGNED(destination) && DMA_COPY_ALIGNED(source);
+
+  state->destination = (volatile uint16_t *)destination;
+  state->source = (const volatile uint16_t *)source;
+  state->size = wide ? DMA_SIZE_32 : DMA_SIZE_16;
+  state->left = wide ? (length / 2) : length;
+  state->fill = fill;
+  state->callback = callback;
+  state->status = E_DMA_BUSY;
+  state->busy = 1;
+
+  return DMA_COPY_NEXT();
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_dma dmaCopyInit(void)
+{
+  err_dma ret = E_DMA_OK;
+
+  if(dmaCopyChannel == DMA_CH_MIN)
+  {
+    ret = dmaAlloc(&dmaCopyChannel);
+    if(ret != E_DMA_OK)
+    {
+      dmaCopyChannel = DMA_CH_MIN;
+    }
+  }
+
+  return ret;
+}
+
+err_dma dmaCopy(volatile void *destination, const volatile void *source, uint32_t length, DMA_Callback callback)
+{
+  return DMA_COPY_START(destination, source, length, 0, callback);
+}
+
+err_dma dmaFill(volatile void *destination, uint16_t value, uint32_t length, DMA_Callback callback)
+{
+  if(dmaCopyState.busy)
+  {
+    return E_DMA_BUSY;
+  }
+
+  dmaCopyPattern = ((uint32_t)value << 16) | value;
+  return DMA_COPY_START(destination, &dmaCopyPattern, length, 1, callback);
+}
+
+uint16_t dmaCopyBusy(void)
+{
+  return dmaCopyState.busy;
+}
+
+err_dma dmaCopyStatus(void)
+{
+  return dmaCopyState.status;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file DriverDMACopy.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of DMA memory copy and fill engine for RAM-to-RAM bulk moves (log frames, inputs of
+ * FFT). Block is moved by one channel allocated from DMA driver, started by software trigger (PERINTFRC) in
+ * one-shot mode, so CPU only programs channel and continues control loop while words are moved. End of
+ * move is reported by callback from ISR of channel or polled by dmaCopyBusy(). Buffs must be at GS RAM and
+ * must not overlap. Aligned blocks of even length are moved as 32-bit words.
+ *
+ *   dmaCopyInit();
+ *   dmaCopy(fftInput, logFrame, 1024, fftReady);
+ *   ...                                                       //control loop runs
+ */
+
+#ifndef DRIVERDMACOPY_H_
+#define DRIVERDMACOPY_H_
+
+#include <stdint.h>
+#include "DriverDMA.h"
+
+/**
+ * @brief Function used to allocate channel of engine from DMA driver
+ *
+ * @return Status of operation, E_DMA_NO_CHANNEL if all channels are allocated
+ */
+err_dma dmaCopyInit(void);
+
+/**
+ * @brief Function used to start copy of block, like memcpy(). Block longer than one transfer is moved by
+ * next transfers started from ISR.
+ *
+ * @param volatile void *destination - destination at GS RAM
+ * @param const volatile void *source - source at GS RAM
+ * @param uint32_t length - 16-bit words of block
+ * @param DMA_Callback callback - called from ISR when the whole block is moved or move failed, see
+ *                                dmaCopyStatus(), NULL if not used
+ *
+ * @return Status of operation, E_DMA_BUSY if previous move is not finished
+ */
+err_dma dmaCopy(volatile void *destination, const volatile void *source, uint32_t length, DMA_Callback callback);
+
+/**
+ * @brief Function used to start fill of block with value, like memset() of 16-bit words
+ *
+ * @param volatile void *destination - destination at GS RAM
+ * @param uint16_t value - value of every word
+ * @param uint32_t length - 16-bit words of block
+ * @param DMA_Callback callback - called from ISR when the whole block is filled or fill failed, see
+ *                                dmaCopyStatus(), NULL if not used
+ *
+ * @return Status of operation, E_DMA_BUSY if previous move is not finished
+ */
+err_dma dmaFill(volatile void *destination, uint16_t value, uint32_t length, DMA_Callback callback);
+
+/**
+ * @brief Function used to check if move is running
+ *
+ * @return 1 - move is running, 0 - engine is free
+ */
+uint16_t dmaCopyBusy(void);
+
+/**
+ * @brief Function used to read result of the last move, i.e. from callback. Next transfer of long block is
+ * started from ISR, so its error is reported only here.
+ *
+ * @return E_DMA_BUSY if move is running, E_DMA_OK if the whole block is moved, else error of dmaStart()
+ */
+err_dma dmaCopyStatus(void);
+
+#endif /* DRIVERDMACOPY_H_ */
@@ -0,0 +1,323 @@
+/**
+ * @file DriverDMASched.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of DMA channel scheduler working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverDMASched.h"
+
+#define DMA_SCHED_NUMBER      6
+
+/**
+ * @brief State of channel assigned by scheduler
+ */
+typedef struct
+{
+  uint16_t used;
+  uint16_t budget;
+  uint32_t latency;
+  uint32_t active;                    //samples when channel was active
+  uint32_t wait;                      //samples of current wait of event
+  uint32_t waitMax;
+} DMA_SchedChannel;
+
+static DMA_SchedChannel dmaSched[DMA_SCHED_NUMBER];
+static uint32_t dmaSchedSamples;
+static uint32_t dmaSchedPeriod;
+
+//******************************************************STATIC FUNCTION**************************************************
+
+/**
+ * @brief Static function used to compute SYSCLK cycles of one burst of stream
+ */
+static uint32_t DMA_SCHED_BURST(const DMA_SchedStream *stream)
+{
+  uint32_t elements = (stream->size == DMA_SIZE_32) ? (stream->words / 2) : stream->words;
+
+  return elements * DMA_CYCLES_ELEMENT + DMA_CYCLES_BURST;
+}
+
+static err_dma DMA_SCHED_CHECK(const DMA_SchedStream *stream)
+{
+  if((stream->words == 0) || (stream->words > DMA_BURST_MAX) || (stream->period == 0) ||
+     (stream->deadline == 0) || (stream->deadline > stream->period) ||
+     ((uint32_t)stream->size >= DMA_SIZE_MAX) || ((stream->size == DMA_SIZE_32) && (stream->words % 2)))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  return E_DMA_OK;
+}
+
+/**
+ * @brief Static function used to sort streams by deadline, the shortest is the first
+ */
+static void DMA_SCHED_SORT(const DMA_SchedStream *streams, uint16_t number, uint16_t *order)
+{
+  uint16_t i = 0;
+  uint16_t j = 0;
+  uint16_t index = 0;
+
+  for(i = 0; i < number; i++)
+  {
+    index = i;
+    for(j = i; (j > 0) && (streams[order[j - 1]].deadline > streams[index].deadline); j--)
+    {
+      order[j] = order[j - 1];
+    }
+    order[j] = index;
+  }
+}
+
+/**
+ * @brief Static function used to compute worst-case latency of every stream. Stream order[0] is at DMA_CH1 in
+ * high priority mode and it waits only for one word of interrupted channel. Other streams wait for one
+ * burst of every round robin stream, during that time DMA_CH1 takes its burst at every its event.
+ *
+ * @return Status of operation, E_DMA_OVERLOAD if any stream misses deadline or DMA is overloaded
+ */
+static err_dma DMA_SCHED_ANALYSE(DMA_SchedStream *streams, uint16_t number, const uint16_t *order)
+{
+  err_dma ret = E_DMA_OK;
+  DMA_SchedStream *high = &streams[order[0]];
+  DMA_SchedStream *stream = NULL;
+  uint32_t highBurst = DMA_SCHED_BURST(high);
+  uint32_t robin = 0;
+  uint32_t budget = 0;
+  uint32_t latency = 0;
+  uint32_t next = 0;
+  uint16_t i = 0;
+
+  for(i = 0; i < number; i++)
+  {
+    stream = &streams[i];
+    budget += (DMA_SCHED_BURST(stream) * DMA_SCHED_PERMILLE + stream->period - 1) / stream->period;
+    if(i > 0)
+    {
+      robin += DMA_SCHED_BURST(&streams[order[i]]);
+    }
+  }
+
+  high->latency = ((number > 1) ? DMA_CYCLES_ELEMENT : 0) + highBurst;
+  if((budget > DMA_SCHED_PERMILLE) || (high->latency > high->deadline))
+  {
+    ret = E_DMA_OVERLOAD;
+  }
+
+  for(i = 1; i < number; i++)
+  {
+    stream = &streams[order[i]];
+
+    //the latency grows with every event of DMA_CH1 inside it, it is stopped at the first miss of deadline
+    next = robin;
+    do
+    {
+      latency = next;
+      next = robin + ((latency + high->period - 1) / high->period) * highBurst;
+    } while((next != latency) && (next <= stream->deadline));
+
+    stream->latency = next;
+    if(next > stream->deadline)
+    {
+      ret = E_DMA_OVERLOAD;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Static function used to allocate channels of streams, DMA_CH1 is claimed for the shortest deadline
+ */
+static err_dma DMA_SCHED_ALLOC(DMA_SchedStream *streams, uint16_t number, const uint16_t *order)
+{
+  err_dma ret = E_DMA_OK;
+  uint16_t i = 0;
+
+  ret = dmaClaim(DMA_CH1);
+  if(ret == E_DMA_OK)
+  {
+    streams[order[0]].channel = DMA_CH1;
+  }
+
+  for(i = 1; (i < number) && (ret == E_DMA_OK); i++)
+  {
+    ret = dmaAlloc(&streams[order[i]].channel);
+  }
+
+  if(ret != E_DMA_OK)
+  {
+    for(i = 0; i < number; i++)
+    {
+      if(streams[i].channel != DMA_CH_MIN)
+      {
+        (void)dmaFree(streams[i].channel);
+        streams[i].channel = DMA_CH_MIN;
+      }
+    }
+  }
+
+  return ret;
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_dma dmaSchedCfg(DMA_SchedStream *streams, uint16_t number, uint32_t samplePeriod)
+{
+  err_dma ret = E_DMA_OK;
+  DMA_SchedStream *stream = NULL;
+  uint16_t order[DMA_SCHED_NUMBER];
+  uint16_t i = 0;
+
+  if((streams == NULL) || (number == 0) || (number > DMA_SCHED_NUMBER))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  for(i = 0; (i < number) && (ret == E_DMA_OK); i++)
+  {
+    streams[i].channel = DMA_CH_MIN;
+    streams[i].latency = 0;
+    ret = DMA_SCHED_CHECK(&streams[i]);
+  }
+
+  if(ret == E_DMA_OK)
+  {
+    DMA_SCHED_SORT(streams, number, order);
+    ret = DMA_SCHED_ANALYSE(streams, number, order);
+  }
+
+  if(ret == E_DMA_OK)
+  {
+    ret = DMA_SCHED_ALLOC(streams, number, order);
+  }
+
+  if(ret == E_DMA_OK)
+  {
+    for(i = 0; i < DMA_SCHED_NUMBER; i++)
+    {
+      dmaSched[i].used = 0;
+    }
+
+    for(i = 0; i < number; i++)
+    {
+      stream = &streams[i];
+      dmaSched[stream->channel].used = 1;
+      dmaSched[stream->channel].budget =
+          (uint16_t)((DMA_SCHED_BURST(stream) * DMA_SCHED_PERMILLE + stream->period - 1) / stream->period);
+      dmaSched[stream->channel].latency = stream->latency;
+      dmaSched[stream->channel].active = 0;
+      dmaSched[stream->channel].wait = 0;
+      dmaSched[stream->channel].waitMax = 0;
+    }
+    dmaSchedSamples = 0;
+    dmaSchedPeriod = samplePeriod;
+
+    //DMA_CH1 is halted, it was just claimed
+    EALLOW;
+    DmaRegs.PRIORITYCTRL1.bit.CH1PRIORITY = 1;
+    EDIS;
+  }
+
+  return ret;
+}
+
+err_dma dmaSchedFree(void)
+{
+  err_dma ret = E_DMA_NOT_INITIALIZE;
+  uint16_t i = 0;
+
+  for(i = 0; i < DMA_SCHED_NUMBER; i++)
+  {
+    if(dmaSched[i].used)
+    {
+      (void)dmaFree((DMA_ChannelType)i);
+      dmaSched[i].used = 0;
+      ret = E_DMA_OK;
+    }
+  }
+
+  //DMA_CH1 is halted by dmaFree()
+  if(ret == E_DMA_OK)
+  {
+    EALLOW;
+    DmaRegs.PRIORITYCTRL1.bit.CH1PRIORITY = 0;
+    EDIS;
+  }
+
+  return ret;
+}
+
+void dmaSchedSample(void)
+{
+  DMA_SchedChannel *state = NULL;
+  union PRIORITYSTAT_REG status;
+  uint16_t active = 0;
+  uint16_t interrupted = 0;
+  uint16_t waiting = 0;
+  uint16_t i = 0;
+
+  //register is read once, so active and interrupted channel are of the same moment
+  status.all = DmaRegs.PRIORITYSTAT.all;
+  active = status.bit.ACTIVESTS;
+  interrupted = status.bit.ACTIVESTS_SHADOW;
+
+  dmaSchedSamples++;
+  for(i = 0; i < DMA_SCHED_NUMBER; i++)
+  {
+    state = &dmaSched[i];
+    if(!state->used)
+    {
+      continue;
+    }
+
+    //ACTIVESTS is channel + 1, 0 if DMA is idle. Event is latched but other channel is active, or burst is
+    //interrupted by DMA_CH1
+    waiting = (active != i + 1) &&
+              ((((&DmaRegs.CH1 + i)->CONTROL.bit.PERINTFLG) != 0) || (interrupted == i + 1));
+    if(active == i + 1)
+    {
+      state->active++;
+    }
+
+    if(waiting)
+    {
+      state->wait++;
+      if(state->wait > state->waitMax)
+      {
+        state->waitMax = state->wait;
+      }
+    }
+    else
+    {
+      state->wait = 0;
+    }
+  }
+}
+
+err_dma dmaSchedStats(DMA_ChannelType channel, DMA_SchedStats *stats)
+{
+  DMA_SchedChannel *state = NULL;
+
+  if(((uint32_t)channel >= DMA_SCHED_NUMBER) || (stats == NULL))
+  {
+    return E_DMA_INVALID_PARAM;
+  }
+
+  state = &dmaSched[channel];
+  if(!state->used)
+  {
+    return E_DMA_NOT_INITIALIZE;
+  }
+
+  stats->budget = state->budget;
+  stats->usage = (dmaSchedSamples > 0) ?
+                 (uint16_t)(((uint64_t)state->active * DMA_SCHED_PERMILLE) / dmaSchedSamples) : 0;
+  stats->latency = state->latency;
+  stats->waitMax = state->waitMax * dmaSchedPeriod;
+
+  return E_DMA_OK;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file DriverDMASched.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of DMA channel scheduler. Streams (ADC, SPI, McBSP) declare period of trigger events,
+ * words moved at each event and deadline. Scheduler checks that every stream meets its deadline, then
+ * channels are assigned by deadline: the stream with the shortest deadline gets DMA_CH1 in high priority
+ * mode (PRIORITYCTRL1.CH1PRIORITY), other streams get channels served by round robin. Configuration which
+ * can not meet declared rates is refused and no channel is allocated. Other drivers (SPI, DMA copy) take
+ * their channels by dmaAlloc(), which gives DMA_CH1 as the last one, so DMA_CH1 is free for scheduler
+ * unless five channels are allocated before dmaSchedCfg().
+ *
+ * Worst-case latency from event to end of burst is computed with cost of burst DMA_CYCLES_ELEMENT for every
+ * element and DMA_CYCLES_BURST for every burst:
+ *   DMA_CH1     - one word of interrupted channel + its own burst
+ *   other       - one burst of every round robin stream + bursts of DMA_CH1 made during that time
+ *
+ * Bandwidth use and queueing latency are measured by dmaSchedSample() from PRIORITYSTAT, i.e called by timer ISR:
+ *
+ *   static DMA_SchedStream streams[] =
+ *   {
+ *     { 20000, 2000, 16, DMA_SIZE_16, DMA_CH_MIN, 0 },        //ADC results, 10 kHz
+ *     { 4000, 4000, 2, DMA_SIZE_32, DMA_CH_MIN, 0 },          //McBSP, 50 kHz
+ *   };
+ *
+ *   if(dmaSchedCfg(streams, 2, 200) == E_DMA_OK)
+ *   {
+ *     dmaBufferStart(streams[0].channel, &adcStream);
+ *     dmaStart(streams[1].channel, &mcbspTransfer);
+ *   }
+ */
+
+#ifndef DRIVERDMASCHED_H_
+#define DRIVERDMASCHED_H_
+
+#include <stdint.h>
+#include "DriverDMA.h"
+
+#define DMA_CYCLES_ELEMENT          4       //SYSCLK cycles of one 16 or 32-bit element
+#define DMA_CYCLES_BURST            1       //SYSCLK cycles between bursts
+#define DMA_SCHED_PERMILLE          1000    //unit of bandwidth
+
+/**
+ * @brief Stream declared for scheduler, one burst is moved at each trigger event
+ */
+typedef struct
+{
+  uint32_t period;          //the shortest time between trigger events, SYSCLK cycles
+  uint32_t deadline;        //time from event to end of its burst, SYSCLK cycles, at most period
+  uint16_t words;           //16-bit words moved at each event, up to DMA_BURST_MAX
+  DMA_SizeType size;        //size of element of transfer
+  DMA_ChannelType channel;  //written by dmaSchedCfg(), DMA_CH_MIN if configuration is refused
+  uint32_t latency;         //worst-case latency written by dmaSchedCfg(), SYSCLK cycles
+} DMA_SchedStream;
+
+/**
+ * @brief Statistics of channel of scheduler
+ */
+typedef struct
+{
+  uint16_t budget;          //declared bandwidth, 1/DMA_SCHED_PERMILLE of DMA time
+  uint16_t usage;           //measured bandwidth, 1/DMA_SCHED_PERMILLE of samples when channel was active
+  uint32_t latency;         //computed worst-case latency, SYSCLK cycles
+  uint32_t waitMax;         //measured worst-case queueing latency, SYSCLK cycles (samples * sample period)
+} DMA_SchedStats;
+
+/**
+ * @brief Function used to check streams and allocate their channels. Must be called before channels are
+ * started, because CH1PRIORITY can be changed only when DMA_CH1 is halted.
+ *
+ * @param DMA_SchedStream *streams - table of streams, channel and latency of every stream are written
+ * @param uint16_t number - number of streams, up to 6
+ * @param uint32_t samplePeriod - SYSCLK cycles between calls of dmaSchedSample(), used to scale waitMax
+ *
+ * @return Status of operation, E_DMA_OVERLOAD if streams can not meet deadlines, E_DMA_BUSY if channel is
+ *         allocated by other driver or previous configuration is not freed by dmaSchedFree()
+ */
+err_dma dmaSchedCfg(DMA_SchedStream *streams, uint16_t number, uint32_t samplePeriod);
+
+/**
+ * @brief Function used to release configuration of dmaSchedCfg(). Channels of streams are stopped and freed,
+ * statistics are not kept and DMA_CH1 is returned to round robin (CH1PRIORITY cleared). Channels written
+ * to streams are not valid after this call.
+ *
+ * @return Status of operation, E_DMA_NOT_INITIALIZE if there is no configuration
+ */
+err_dma dmaSchedFree(void);
+
+/**
+ * @brief Function used to take one sample of PRIORITYSTAT and of pending events of channels. Called
+ * periodically, i.e from timer ISR every samplePeriod cycles.
+ */
+void dmaSchedSample(void);
+
+/**
+ * @brief Function used to read statistics of channel assigned by dmaSchedCfg()
+ *
+ * @param DMA_ChannelType channel - channel of stream
+ * @param DMA_SchedStats *stats - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_dma dmaSchedStats(DMA_ChannelType channel, DMA_SchedStats *stats);
+
+#endif /* DRIVERDMASCHED_H_ */
@@ -0,0 +1,181 @@
+/**
+ * @file DriverDebounce.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of GPIO debounce engine working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverDebounce.h"
+
+#define DEBOUNCE_QUEUE_MASK    (DEBOUNCE_QUEUE_SIZE - 1)
+
+#if (DEBOUNCE_QUEUE_SIZE & DEBOUNCE_QUEUE_MASK) != 0
+#error "DEBOUNCE_QUEUE_SIZE must be power of 2"
+#endif
+
+/**
+ * @brief Debounce state of one port. Bit 'n' of every word belongs to pin 'n' of port.
+ */
+typedef struct
+{
+  volatile uint32_t *data;    //GPxDAT of port
+  GPIOPort_Type port;
+  uint32_t mask;              //debounced pins
+  uint32_t state;             //debounced state
+  uint32_t count0;            //vertical counter, bit 0
+  uint32_t count1;            //vertical counter, bit 1
+} Debounce_Port;
+
+/**
+ * @brief Ring buffer of events. Head is written only by ISR, tail only by background loop.
+ */
+typedef struct
+{
+  DebounceEvent_Type event[DEBOUNCE_QUEUE_SIZE];
+  volatile uint16_t head;
+  volatile uint16_t tail;
+  uint32_t overflow;
+} Debounce_Queue;
+
+static Debounce_Port debouncePorts[GPIO_NUMBER_OF_PORTS];  //only first 'debouncePortsNumber' are used
+static uint16_t debouncePortsNumber;
+static Debounce_Queue debounceQueue;
+static uint32_t debounceTicks;
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static Debounce_Port* DEBOUNCE_FIND(GPIOPort_Type port)
+{
+  Debounce_Port *ret = NULL;
+  uint16_t i = 0;
+
+  for(i = 0; i < debouncePortsNumber; i++)
+  {
+    if(debouncePorts[i].port == port)
+    {
+      ret = &debouncePorts[i];
+      break;
+    }
+  }
+
+  return ret;
+}
+
+static void DEBOUNCE_PUT(GPIOPort_Type port, uint32_t rising, uint32_t falling)
+{
+  uint16_t head = debounceQueue.head;
+  DebounceEvent_Type *event = NULL;
+
+  if((uint16_t)(head - debounceQueue.tail) >= DEBOUNCE_QUEUE_SIZE)
+  {
+    debounceQueue.overflow++;
+  }
+  else
+  {
+    event = &debounceQueue.event[head & DEBOUNCE_QUEUE_MASK];
+    event->tick = debounceTicks;
+    event->port = port;
+    event->rising = rising;
+    event->falling = falling;
+
+    //event is written before head is moved, so background loop never see half of event
+    debounceQueue.head = head + 1;
+  }
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+void debounceInit(void)
+{
+  debouncePortsNumber = 0;
+  debounceTicks = 0;
+  debounceQueue.head = 0;
+  debounceQueue.tail = 0;
+  debounceQueue.overflow = 0;
+}
+
+err_debounce debouncePortAdd(GPIOPort_Type port, uint32_t mask)
+{
+  err_debounce ret = E_DEBOUNCE_OK;
+  Debounce_Port *debounce = NULL;
+  GPIOPin_Type handle;
+
+  if(pinGPIOHandle((uint32_t)port * 32, &handle) != E_GPIO_OK)
+  {
+    ret = E_DEBOUNCE_INVALID_PARAM;
+  }
+  else
+  {
+    debounce = DEBOUNCE_FIND(port);
+    if(debounce == NULL)
+    {
+      debounce = &debouncePorts[debouncePortsNumber++];
+    }
+
+    debounce->data = handle.data;
+    debounce->port = port;
+    debounce->mask = mask;
+    debounce->state = handle.data[GPIO_PORT_DAT] & mask;
+    debounce->count0 = 0;
+    debounce->count1 = 0;
+  }
+
+  return ret;
+}
+
+void debounceTick(void)
+{
+  Debounce_Port *debounce = debouncePorts;
+  uint16_t i = 0;
+
+  debounceTicks++;
+
+  for(i = 0; i < debouncePortsNumber; i++, debounce++)
+  {
+    uint32_t delta = (debounce->data[GPIO_PORT_DAT] & debounce->mask) ^ debounce->state;
+    uint32_t changed = 0;
+
+    //pins equal to debounced state reset its counter, other pins count up. Pin which counter overflows
+    //after DEBOUNCE_SAMPLES samples changes state
+    debounce->count1 = (debounce->count1 ^ debounce->count0) & delta;
+    debounce->count0 = ~debounce->count0 & delta;
+    changed = delta & ~(debounce->count0 | debounce->count1);
+
+    if(changed != 0)
+    {
+      debounce->state ^= changed;
+      DEBOUNCE_PUT(debounce->port, changed & debounce->state, changed & ~debounce->state);
+    }
+  }
+}
+
+err_debounce debounceEventGet(DebounceEvent_Type *event)
+{
+  err_debounce ret = E_DEBOUNCE_EMPTY;
+  uint16_t tail = debounceQueue.tail;
+
+  if(tail != debounceQueue.head)
+  {
+    *event = debounceQueue.event[tail & DEBOUNCE_QUEUE_MASK];
+
+    //event is copied before tail is moved, so ISR never overwrite it
+    debounceQueue.tail = tail + 1;
+    ret = E_DEBOUNCE_OK;
+  }
+
+  return ret;
+}
+
+uint32_t debounceState(GPIOPort_Type port)
+{
+  Debounce_Port *debounce = DEBOUNCE_FIND(port);
+
+  return (debounce != NULL) ? debounce->state : 0;
+}
+
+uint32_t debounceOverflow(void)
+{
+  return debounceQueue.overflow;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file DriverDebounce.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of GPIO debounce engine. Whole port word is sampled at every tick of timer and all 32
+ * pins are debounced at once by vertical counters (one bit of counter for each pin at separate word). Pin
+ * changes debounced state after DEBOUNCE_SAMPLES equal samples. Debounced edges are queued at lock-free
+ * ring buffer, written only by debounceTick() (ISR) and read only by debounceEventGet() (background loop).
+ *
+ *   debouncePortAdd(PORT_A, (1UL << 4) | (1UL << 5));     //configure pins as input before
+ *
+ *   interrupt void timer0(void)
+ *   {
+ *     debounceTick();
+ *     ...
+ *   }
+ *
+ *   while(debounceEventGet(&event) == E_DEBOUNCE_OK) { ... }
+ */
+
+#ifndef DRIVERDEBOUNCE_H_
+#define DRIVERDEBOUNCE_H_
+
+#include <stdint.h>
+#include "DriverGPIO.h"
+
+typedef int err_debounce;
+
+/**
+ * @brief Numeric representation of debounce error
+ */
+#define E_DEBOUNCE_OK               0     //Operation successful
+#define E_DEBOUNCE_INVALID_PARAM   -1     //Invalid parameters
+#define E_DEBOUNCE_EMPTY           -2     //No event at queue
+
+#define DEBOUNCE_SAMPLES            4     //equal samples needed to change state, size of vertical counter is 2 bits
+#define DEBOUNCE_QUEUE_SIZE         16    //number of events at queue, must be power of 2
+
+/**
+ * @brief Debounced edges of one port at one tick
+ */
+typedef struct
+{
+  uint32_t tick;              //number of tick when edge was detected
+  GPIOPort_Type port;         //port of pins
+  uint32_t rising;            //mask of pins with rising edge, bit 0 is first pin of port
+  uint32_t falling;           //mask of pins with falling edge
+} DebounceEvent_Type;
+
+/**
+ * @brief Function used to clear engine, all ports are removed and queue is cleared
+ */
+void
+debounceInit(void);
+
+/**
+ * @brief Function used to start debounce of pins at port. Current state of pins is taken as debounced
+ * state, so there is no event at start. Can be called again for the same port to change mask.
+ * Should not be called when debounceTick() can interrupt it.
+ *
+ * @param GPIOPort_Type port - port of pins
+ * @param uint32_t mask - mask of pins which are debounced, bit 0 is first pin of port
+ *
+ * @return Status of operation
+ */
+err_debounce
+debouncePortAdd(GPIOPort_Type port, uint32_t mask);
+
+/**
+ * @brief Function used to sample all added ports, should be called from timer ISR. One read of GPxDAT
+ * for each port.
+ */
+void
+debounceTick(void);
+
+/**
+ * @brief Function used to take the oldest event from queue, called from background loop
+ *
+ * @param DebounceEvent_Type *event - pointer where event is written
+ *
+ * @return E_DEBOUNCE_OK if event is taken, E_DEBOUNCE_EMPTY if queue is empty
+ */
+err_debounce
+debounceEventGet(DebounceEvent_Type *event);
+
+/**
+ * @brief Function used to read debounced state of port
+ *
+ * @param GPIOPort_Type port - port of pins
+ *
+ * @return Debounced state of pins, bit 0 is first pin of port. Pins which are not debounced are 0
+ */
+uint32_t
+debounceState(GPIOPort_Type port);
+
+/**
+ * @brief Function used to read number of events lost because queue was full
+ *
+ * @return Number of lost events
+ */
+uint32_t
+debounceOverflow(void);
+
+#endif /* DRIVERDEBOUNCE_H_ */
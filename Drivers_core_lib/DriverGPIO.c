@@ -12,12 +12,14 @@
 #include "F2837xS_device.h"
 
 //OFFSET of first CTRL register of GPIO
+#ifndef HOST_SIM
 #define GPIO_CTRL_REG_F2877S 0x00007C00
 #define GPIO_DATA_REG_F2877S 0x00007F00
-
-//defines of specific hardware parameters
-#define NUMBER_OF_PINS              168
-#define SAMPLING_PERIOD_DIVIDER     512
+#else
+//at host build registers are RAM images, see HostSim.h
+#define GPIO_CTRL_REG_F2877S ((uintptr_t)&GpioCtrlRegs)
+#define GPIO_DATA_REG_F2877S ((uintptr_t)&GpioDataRegs)
+#endif
 
 #define GPY_CTRL_OFFSET    (0x40/2)
 #define GPY_DATA_OFFSET    (0x8/2)
@@ -33,409 +35,520 @@
 #define GPYLOCK            (0x3C/2)
 #define GPYCR              (0x3E/2)
 
-#define GPYDAT             (0x0/2)
-#define GPYSET             (0x2/2)
-#define GPYCLEAR           (0x4/2)
-#define GPYTOGGLE          (0x6/2)
+#define GPYDAT             (0x0/2)        //GPxSET, GPxCLEAR, GPxTOGGLE see GPIO_PORT_* at DriverGPIO.h
+
+#define GPYREG_ALL         0xFFFFFFFFUL   //all bits of register are changed
 
 /**
- * @brief Address of specific GPIO registers
+ * @brief Offset of control register from GPxCTRL for every index of image
  */
-typedef struct
+static const uint16_t GPIO_IMG_OFFSET[GPIO_IMG_NUMBER] =
 {
-  volatile uint32_t *base_address;
-  volatile uint32_t *ctrl;
-  volatile uint32_t *qsel;
-  volatile uint32_t *mux;
-  volatile uint32_t *dir;
-  volatile uint32_t *pud;
-  volatile uint32_t *inv;
-  volatile uint32_t *odr;
-  volatile uint32_t *gmux;
-  volatile uint32_t *csel;
-  volatile uint32_t *lock;
-  volatile uint32_t *cr;
-
-} GPIO_RegisterAddress;
+  0,
+  GPYQSEL, GPYQSEL + 1,
+  GPYGMUX, GPYGMUX + 1,
+  GPYMUX, GPYMUX + 1,
+  GPYCSEL, GPYCSEL + 1, GPYCSEL + 2, GPYCSEL + 3,
+  GPYODR,
+  GPYPUD,
+  GPYINV,
+  GPYDIR
+};
 
 /**
- * @brief Offset of pin
+ * @brief Field of control register changed by config of one pin
  */
 typedef struct
 {
-  uint16_t pin32;
-  uint16_t pin16;
-  uint16_t pin8;
-  uint16_t pin4;
-} GPIO_PinOffset;
+  uint16_t index;           //index of register, see GPIO_IMG_*
+  uint32_t mask;            //bits of field
+  uint32_t value;           //new value of field
+} GPIO_PinField;
+
+#define GPIO_PIN_FIELDS    8              //number of fields changed by config of one pin
+#define GPIO_PIN_FIELD_MUX 3              //position of GPxMUX field at list of fields
 
 /**
- * @brief Static function used to set register address
+ * @brief Static function used to make list of fields changed by config of pin. Fields are in order of write.
  */
-static void GPIO_REGISTER(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOffset)
-{
-  //offset of pin
-  pinOffset->pin32 = gpio->pin % 32;
-  pinOffset->pin16 = gpio->pin % 16;
-  pinOffset->pin8 = gpio->pin % 8;
-  pinOffset->pin4 = gpio->pin % 4;
-
-  //address of specific registers. Make a array of register for easy numerical operation
-  registers->base_address = (uint32_t *) GPIO_CTRL_REG_F2877S + (gpio->pin / 32) * GPY_CTRL_OFFSET;
-  registers->ctrl = registers->base_address;
-  registers->qsel = registers->base_address + GPYQSEL + (pinOffset->pin32) / 16;
-  registers->mux = registers->base_address + GPYMUX + (pinOffset->pin32) / 16;
-  registers->dir = registers->base_address + GPYDIR;
-  registers->pud = registers->base_address + GPYPUD;
-  registers->inv = registers->base_address + GPYINV;
-  registers->odr = registers->base_address + GPYODR;
-  registers->gmux = registers->base_address + GPYGMUX + (pinOffset->pin32) / 16;
-  registers->csel = registers->base_address + GPYCSEL + (pinOffset->pin32) / 8;
-  registers->lock = registers->base_address + GPYLOCK;
-  registers->cr = registers->base_address + GPYCR;
-}
-
-static void GPIO_LOCK_REGISTER(int32_t pin, volatile uint32_t *lock_register)
-{
-  //base register
-  volatile uint32_t* base = (uint32_t *) GPIO_CTRL_REG_F2877S + (pin / 32) * GPY_CTRL_OFFSET;
-  lock_register = base + GPYLOCK;       //address to lock register
-}
-
-static void GPIO_SETUP_MUX(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
+static void GPIO_PIN_FIELD_LIST(const GPIOCfg_Type* gpio, GPIO_PinField *field)
 {
-  EALLOW;
-  *registers->mux &= ~(0x3UL << (2 * pinOff->pin16));                                         //clear specific place at register
-  *registers->gmux &= ~(0x3UL << (2 * pinOff->pin16));
+  uint16_t pin32 = gpio->pin % 32;
+  uint16_t shift2 = 2 * (gpio->pin % 16);
+  uint16_t shift4 = 4 * (gpio->pin % 8);
+  uint16_t shift8 = 8 * (pin32 / 8);
+  uint32_t pinMask = 1UL << pin32;                       //make mask of for one bit in register
+  uint32_t function = (uint32_t)gpio->pinFunction - 1;  //minus '1' because at interface is numerate from '1'
 
-  //Data Synchronization Barrier, wait until memory is idle
-  //__asm("DSB");
-  *registers->gmux |= (uint32_t)(((gpio->pinFunction-1) >> 2) & 0x3UL) << (2 * pinOff->pin16);    //from 0b1111 take only younger '11' and write to register
-  *registers->mux |= (uint32_t)((gpio->pinFunction-1) & 0x3UL) << (2 * pinOff->pin16);            //take older '11'
-  EDIS;
-}
+  //Qualification Sampling Period Control, one 8-bit field for each 8 pins
+  field[0] = (GPIO_PinField){ GPIO_IMG_CTRL, 0xFFUL << shift8, ((uint32_t)gpio->samplingPeriod & 0xFFUL) << shift8 };
 
-static void GPIO_SETUP_INPUT(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
-{
-  uint32_t pinMask = 0;
-  pinMask = 1UL << pinOff->pin32;               //make mask of for one bit in register
+  //Qualifier Select
+  field[1] = (GPIO_PinField){ GPIO_IMG_QSEL + pin32 / 16, 0x3UL << shift2, ((uint32_t)gpio->samplingQualification - 1) << shift2 };
 
-  EALLOW;
+  //from 0b1111 take younger '11' to mux and older '11' to gmux
+  field[2] = (GPIO_PinField){ GPIO_IMG_GMUX + pin32 / 16, 0x3UL << shift2, ((function >> 2) & 0x3UL) << shift2 };
+  field[GPIO_PIN_FIELD_MUX] = (GPIO_PinField){ GPIO_IMG_MUX + pin32 / 16, 0x3UL << shift2, (function & 0x3UL) << shift2 };
 
-  //input mode
-  *registers->dir &= ~pinMask;
+  //core select, CPU1 or CPU1.CLA
+  field[4] = (GPIO_PinField){ GPIO_IMG_CSEL + pin32 / 8, 0xFUL << shift4, ((gpio->core == CORE_CLA) ? 1UL : 0UL) << shift4 };
 
   //pull up resistor enable/disable
-  if (gpio->pull == PUD_Enable)
+  field[5] = (GPIO_PinField){ GPIO_IMG_PUD, pinMask, (gpio->pull == PUD_Enable) ? 0 : pinMask };
+
+  if(gpio->direction == DIR_Output)
   {
-    *registers->pud &= ~pinMask;
+    //output mode, open-drain or normal output mode
+    field[6] = (GPIO_PinField){ GPIO_IMG_ODR, pinMask, (gpio->type == ODR_NormalOutput) ? 0 : pinMask };
+    field[7] = (GPIO_PinField){ GPIO_IMG_DIR, pinMask, pinMask };
   }
   else
   {
-    *registers->pud |= pinMask;
+    //input mode, invert gpio enable/disable
+    field[6] = (GPIO_PinField){ GPIO_IMG_INV, pinMask, (gpio->invert == INV_InvertEnable) ? pinMask : 0 };
+    field[7] = (GPIO_PinField){ GPIO_IMG_DIR, pinMask, 0 };
   }
+}
 
-  //invert gpio enable/disable
-  if (gpio->invert == INV_InvertEnable)
-  {
-    *registers->inv |= pinMask;
-  }
-  else
+/**
+ * @brief Static function used to add config of pin to image of its port
+ */
+static void GPIO_IMAGE_ADD(const GPIOCfg_Type* gpio, GPIOPortImage_Type *image)
+{
+  GPIO_PinField field[GPIO_PIN_FIELDS];
+  uint16_t i = 0;
+
+  GPIO_PIN_FIELD_LIST(gpio, field);
+
+  for(i = 0; i < GPIO_PIN_FIELDS; i++)
   {
-    *registers->inv &= ~pinMask;
-  }
+    GPIORegImage_Type *reg = &image->reg[field[i].index];
 
-  EDIS;
+    if(image->used & (1U << field[i].index))
+    {
+      reg->clear |= field[i].mask;
+      reg->set = (reg->set & ~field[i].mask) | field[i].value;
+    }
+    else
+    {
+      image->used |= 1U << field[i].index;
+      reg->clear = field[i].mask;
+      reg->set = field[i].value;
+    }
+  }
 }
 
-static void GPIO_SETUP_OUTPUT(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
+/**
+ * @brief Static function used to write image of port to control registers. Register is not read if all
+ * bits are changed and not accessed at all if nothing is changed.
+ */
+static void GPIO_IMAGE_APPLY(uint32_t port, const GPIOPortImage_Type *image)
 {
-  uint32_t pinMask = 0;
-  pinMask = (1UL << pinOff->pin32);               //make mask of for one bit in register
+  volatile uint32_t *base = (uint32_t *)GPIO_CTRL_REG_F2877S + port * GPY_CTRL_OFFSET;
+  const GPIORegImage_Type *reg = image->reg;
+  uint16_t used = image->used;
+  uint16_t i = 0;
 
   EALLOW;
 
-  //output mode
-  *registers->dir |= pinMask;
-
-  //open-drain or normal output mode
-  if(gpio->type == ODR_NormalOutput)
-  {
-    *registers->odr &= ~pinMask;
-  }
-  else
+  //changed pins go to GPIO function first, then GMUX is changed and MUX at the end, so there is
+  //no glitch of other peripheral at pin
+  for(i = GPIO_IMG_MUX; i < GPIO_IMG_MUX + 2; i++)
   {
-    *registers->odr |= pinMask;
+    if(used & (1U << i))
+    {
+      base[GPIO_IMG_OFFSET[i]] &= ~reg[i].clear;
+    }
   }
 
-  //pull up enable/disable
-  if(gpio->pull == PUD_Enable)
-  {
-    *registers->pud &= ~pinMask;
-  }
-  else
+  for(i = 0; used != 0; i++, used >>= 1)
   {
-    *registers->pud |= pinMask;
+    if(used & 0x1)
+    {
+      volatile uint32_t *address = base + GPIO_IMG_OFFSET[i];
+
+      if(reg[i].clear == GPYREG_ALL)
+      {
+        *address = reg[i].set;
+      }
+      else
+      {
+        *address = (*address & ~reg[i].clear) | reg[i].set;
+      }
+    }
   }
 
   EDIS;
 }
 
-static void GPIO_SETUP_SAMPLING(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
+/**
+ * @brief Static function used to resolve data register and mask of pin
+ */
+static void GPIO_PIN_HANDLE(uint32_t pin, GPIOPin_Type *handle)
 {
-  EALLOW;
-
-  //Qualifier Select
-  *registers->qsel &= ~(0x3UL << (2 * pinOff->pin16));       //clear specific place in register
+  handle->data = (uint32_t *)GPIO_DATA_REG_F2877S + (pin / 32) * GPY_DATA_OFFSET + GPYDAT;
+  handle->mask = 1UL << (pin % 32);
+}
 
-  //Data Synchronization Barrier, wait until memory is idle
-  //__asm(:"DSB");
-  *registers->qsel |= (gpio->samplingQualification - 1) << (2 * pinOff->pin16);     //minus '1' because at interface is numerate from '1'
+/**
+ * @brief Static function used to get GPxDAT of port
+ */
+static volatile uint32_t* GPIO_PORT_REGISTER(uint32_t port)
+{
+  return (uint32_t *)GPIO_DATA_REG_F2877S + port * GPY_DATA_OFFSET + GPYDAT;
+}
 
-  //Qualification Sampling Period Control
-  *registers->ctrl &= ~(0x8UL << (8 * pinOff->pin4));                                  //clear specific place in register
+/**
+ * @brief Static function used to write mask to one data register of every port with not empty mask
+ */
+static void GPIO_PORT_MASK_WRITE(const GPIOPortMask_Type *ports, uint16_t reg)
+{
+  uint32_t port = 0;
 
-   //Data Synchronization Barrier, wait until memory is idle
-  //__asm(:"DSB");
-  *registers->ctrl |= (gpio->samplingPeriod << (8 * pinOff->pin4));
+  for(port = 0; port < GPIO_NUMBER_OF_PORTS; port++)
+  {
+    if(ports->mask[port] != 0)
+    {
+      GPIO_PORT_REGISTER(port)[reg] = ports->mask[port];
+    }
+  }
+}
 
-  EDIS;
+/**
+ * @brief Static function used to get GPxLOCK of port of pin
+ */
+static volatile uint32_t* GPIO_LOCK_REGISTER(uint32_t pin)
+{
+  //base register
+  volatile uint32_t* base = (uint32_t *) GPIO_CTRL_REG_F2877S + (pin / 32) * GPY_CTRL_OFFSET;
+  return base + GPYLOCK;                //address to lock register
 }
 
-static void GPIO_SETUP_INVERT(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
+static err GPIO_CHECK(const GPIOCfg_Type* gpio)
 {
-  uint32_t pinMask = 0;
-  pinMask = (1UL << pinOff->pin32);               //make mask of for one bit in register
+  err ret = E_GPIO_OK;
 
-  EALLOW;
-  if(gpio->invert == INV_InvertEnable)
-  {
-    *registers->inv |= pinMask;
-  }
-  else
+  //all fields are checked by range compare, time of check do not depend on config
+  if(!GPIO_CFG_IS_VALID(gpio->pin, gpio->samplingPeriod, gpio->pinFunction, gpio->samplingQualification,
+                        gpio->direction, gpio->pull, gpio->invert, gpio->type, gpio->core))
   {
-    *registers->inv &= ~pinMask;
+    ret = E_GPIO_INVALID_PARAM;
   }
-  EDIS;
+
+  return ret;
 }
 
-static void GPIO_SETUP_CORE(GPIOCfg_Type* gpio, GPIO_RegisterAddress *registers, GPIO_PinOffset *pinOff)
+/**
+ * @brief Static function used to config one pin. Fields are written directly, without image of port.
+ */
+static void GPIO_CONFIG(const GPIOCfg_Type *gpio)
 {
+  volatile uint32_t *base = (uint32_t *)GPIO_CTRL_REG_F2877S + (gpio->pin / 32) * GPY_CTRL_OFFSET;
+  GPIO_PinField field[GPIO_PIN_FIELDS];
+  uint16_t i = 0;
+
+  GPIO_PIN_FIELD_LIST(gpio, field);
+
   EALLOW;
 
-  *registers->csel &= ~(0x3UL << (4*pinOff->pin8));   //clear specific place in register
+  //pin goes to GPIO function first, so there is no glitch of other peripheral when GMUX is changed
+  base[GPIO_IMG_OFFSET[field[GPIO_PIN_FIELD_MUX].index]] &= ~field[GPIO_PIN_FIELD_MUX].mask;
 
-  if(gpio->core == CORE_CLA)
+  for(i = 0; i < GPIO_PIN_FIELDS; i++)
   {
-    *registers->csel |= (uint32_t)(1 << (4 * pinOff->pin8));  //set CLA
+    volatile uint32_t *address = base + GPIO_IMG_OFFSET[field[i].index];
+
+    *address = (*address & ~field[i].mask) | field[i].value;
   }
 
   EDIS;
 }
 
-static err GPIO_CHECK(GPIOCfg_Type* gpio)
+/**
+ * @brief Static function used to config all pins of map. Pins of one port are merged to image of port at
+ * one pass over map, so every port is written once in any order of map. Passes stop when all pins are merged.
+ */
+static void GPIO_CONFIG_MAP(const GPIOCfg_Type *map, uint16_t number)
 {
-  err ret = E_GPIO_OK;
+  GPIOPortImage_Type image;
+  uint32_t port = 0;
+  uint16_t merged = 0;
+  uint16_t i = 0;
 
-  //Check correctness of number of pin
-  int pin = -1;
-  uint32_t i = 0;
-  for(i = 0; i < (uint32_t)NUMBER_OF_PINS; i++)
+  for(port = 0; (port < GPIO_NUMBER_OF_PORTS) && (merged < number); port++)
   {
-    if(gpio->pin == i)
+    image.used = 0;
+
+    for(i = 0; i < number; i++)
     {
-      pin = i;
-      break;
+      if((uint32_t)map[i].pin / 32 == port)
+      {
+        GPIO_IMAGE_ADD(&map[i], &image);
+        merged++;
+      }
     }
-  }
 
-  //Check correctness of number of divider sampling period divider
-  int sampling_period = -1;
-  for(i = 0; i < (uint32_t)SAMPLING_PERIOD_DIVIDER; i++)
-  {
-    if(gpio->samplingPeriod == i)
+    if(image.used != 0)
     {
-      sampling_period = i;
-      break;
+      GPIO_IMAGE_APPLY(port, &image);
     }
   }
+}
+
+//********************************************INTERFACE*********************************************************
+
+err pinGPIOCfg(GPIOCfg_Type *gpio)
+{
+  err ret = E_GPIO_OK;
 
-  //Check correctness number of multiplexing pin function
-  int pin_function = -1;
-  for(i = MUX_MIN; i < MUX_MAX; i++)
+  //check correctness of parameters in gpio struct
+  if (GPIO_CHECK(gpio) == E_GPIO_OK)
   {
-    if(gpio->pinFunction == i)
-    {
-      pin_function = i;
-      break;
-    }
+    GPIO_CONFIG(gpio);
   }
-
-  //Check correctness of sampling qualification
-  int qualification = -1;
-  for(i = QSEL_MIN; i < QSEL_MAX; i++)
+  else
   {
-    if(gpio->samplingQualification == i)
-    {
-      qualification = i;
-      break;
-    }
+    ret = E_GPIO_INVALID_PARAM;
   }
+  return ret;
+}
 
-  //Check correctness of pin direction
-  int direction = -1;
-  for(i = DIR_MIN; i < DIR_MAX; i++)
+err pinGPIOCfgStatic(const GPIOCfg_Type *gpio)
+{
+  //config is validated at compile time by GPIO_CFG_STATIC
+  GPIO_CONFIG(gpio);
+  return E_GPIO_OK;
+}
+
+err pinGPIOCfgMap(const GPIOCfg_Type *map, uint16_t number)
+{
+  err ret = E_GPIO_OK;
+  uint16_t i = 0;
+
+  //nothing is configured if any pin at map is invalid
+  for(i = 0; i < number; i++)
   {
-    if(gpio->direction == i)
+    if(GPIO_CHECK(&map[i]) != E_GPIO_OK)
     {
-      direction = i;
+      ret = E_GPIO_INVALID_PARAM;
       break;
     }
   }
 
-  //Check correctness of pull up
-  int pull = -1;
-  for(i = PUD_MIN; i < PUD_MAX; i++)
+  if(ret == E_GPIO_OK)
   {
-    if(gpio->pull == i)
-    {
-      pull = i;
-      break;
-    }
+    GPIO_CONFIG_MAP(map, number);
   }
 
-  //Check correctness of pin invert
-  int invert = -1;
-  for(i = INV_MIN; i < INV_MAX; i++)
+  return ret;
+}
+
+err pinGPIOCfgMapStatic(const GPIOCfg_Type *map, uint16_t number)
+{
+  //map is validated at compile time by GPIO_PIN_MAP_ENTRY
+  GPIO_CONFIG_MAP(map, number);
+  return E_GPIO_OK;
+}
+
+err pinGPIOCfgImage(const GPIOMapImage_Type *image)
+{
+  err ret = E_GPIO_OK;
+  uint32_t port = 0;
+
+  if(image == NULL)
   {
-    if(gpio->invert == i)
-    {
-      invert = i;
-      break;
-    }
+    ret = E_GPIO_INVALID_PARAM;
   }
-
-  //Check correctness of pin output type
-  int type = -1;
-  for(i = ODR_MIN; i < ODR_MAX; i++)
+  else
   {
-    if(gpio->type == i)
+    //image is validated at compile time by GPIO_MAP_IMAGE
+    for(port = 0; port < GPIO_NUMBER_OF_PORTS; port++)
     {
-      type = i;
-      break;
+      if(image->port[port].used != 0)
+      {
+        GPIO_IMAGE_APPLY(port, &image->port[port]);
+      }
     }
   }
 
-  //Check correctness of pin core
-  int core = -1;
-  for(i = CORE_MIN; i < CORE_MAX; i++)
+  return ret;
+}
+
+err pinGPIOSet(uint32_t pin, GPIOSet_Type state)
+{
+  err ret = E_GPIO_OK;
+  GPIOPin_Type handle;
+
+  GPIO_PIN_HANDLE(pin, &handle);
+
+  //data registers are not EALLOW protected and GPxSET/GPxCLEAR are write-only, so single store is enough
+  if(state == GPIO_SET)
   {
-    if(gpio->core == i)
-    {
-      core = i;
-      break;
-    }
+    pinGPIOHandleSet(&handle);      //set pin
   }
-
-  if(!((pin > -1) && (sampling_period > -1) && (pin_function > 0) && (qualification > 0) && (direction > 0) && (pull > 0) && (invert > 0) && (type > 0) && (core > 0)))
+  else
   {
-    ret = E_GPIO_INVALID_PARAM;
+    pinGPIOHandleClear(&handle);    //reset pin
   }
 
   return ret;
 }
 
+err pinGPIOToogle(uint32_t pin)
+{
+  err ret = E_GPIO_OK;
+  GPIOPin_Type handle;
+
+  GPIO_PIN_HANDLE(pin, &handle);
+  pinGPIOHandleToogle(&handle);
+
+  return ret;
+}
+
+uint32_t pinGPIORead(uint32_t pin)
+{
+  GPIOPin_Type handle;
+
+  GPIO_PIN_HANDLE(pin, &handle);
 
-//********************************************INTERFACE*********************************************************
+  return pinGPIOHandleRead(&handle);
+}
 
-err pinGPIOCfg(GPIOCfg_Type *gpio)
+err pinGPIOHandle(uint32_t pin, GPIOPin_Type *handle)
 {
   err ret = E_GPIO_OK;
 
-  //check correctness of parameters in gpio struct
-  if (GPIO_CHECK(gpio) == E_GPIO_OK)
+  if(pin < GPIO_NUMBER_OF_PINS)
+  {
+    GPIO_PIN_HANDLE(pin, handle);
+  }
+  else
   {
-    //struct with registers address
-    GPIO_RegisterAddress registers_array;
-    //struct with pin offset
-    GPIO_PinOffset pin_offset;
+    ret = E_GPIO_INVALID_PARAM;
+  }
 
-    GPIO_REGISTER(gpio, &registers_array, &pin_offset);         //setup register and pin offset array
-    GPIO_SETUP_SAMPLING(gpio, &registers_array, &pin_offset);   //setup sampling
-    GPIO_SETUP_MUX(gpio, &registers_array, &pin_offset);        //setup multiplexing function of pin
-    GPIO_SETUP_CORE(gpio, &registers_array, &pin_offset);       //setup core for pin
+  return ret;
+}
 
-    if(gpio->direction == DIR_Output)
-    {
-    GPIO_SETUP_OUTPUT(gpio, &registers_array, &pin_offset);     //setup output
-    }
-    else
-    {
-      GPIO_SETUP_INPUT(gpio, &registers_array, &pin_offset);    //setup input
-      GPIO_SETUP_INVERT(gpio, &registers_array, &pin_offset);   //invert signal at pin
-    }
+err portGPIOSet(GPIOPort_Type port, uint32_t mask)
+{
+  err ret = E_GPIO_OK;
+
+  if((uint32_t)port < GPIO_NUMBER_OF_PORTS)
+  {
+    GPIO_PORT_REGISTER(port)[GPIO_PORT_SET] = mask;
   }
+  else
+  {
+    ret = E_GPIO_INVALID_PARAM;
+  }
+
   return ret;
 }
 
-err pinGPIOSet(uint32_t pin, GPIOSet_Type state)
+err portGPIOClear(GPIOPort_Type port, uint32_t mask)
 {
   err ret = E_GPIO_OK;
-  uint32_t pinMask = 0;
 
-  EALLOW;
-  //address of data register
-  volatile uint32_t *data_reg;
-  data_reg = data_reg = (uint32_t *)GPIO_DATA_REG_F2877S + ((pin / 32) * GPY_DATA_OFFSET);
+  if((uint32_t)port < GPIO_NUMBER_OF_PORTS)
+  {
+    GPIO_PORT_REGISTER(port)[GPIO_PORT_CLEAR] = mask;
+  }
+  else
+  {
+    ret = E_GPIO_INVALID_PARAM;
+  }
 
-  pinMask = 1UL << (pin % 32);
+  return ret;
+}
 
-  if(state == GPIO_SET)
+err portGPIOToogle(GPIOPort_Type port, uint32_t mask)
+{
+  err ret = E_GPIO_OK;
+
+  if((uint32_t)port < GPIO_NUMBER_OF_PORTS)
   {
-    data_reg = data_reg + GPYSET;
-    *data_reg |= pinMask;  //set pin
+    GPIO_PORT_REGISTER(port)[GPIO_PORT_TOGGLE] = mask;
   }
   else
   {
-    data_reg = data_reg + GPYCLEAR;
-    *data_reg |= pinMask;  //reset pin
+    ret = E_GPIO_INVALID_PARAM;
   }
 
-  EDIS;
   return ret;
 }
 
-err pinGPIOToogle(uint32_t pin)
+err portGPIOWrite(GPIOPort_Type port, uint32_t mask, uint32_t value)
 {
   err ret = E_GPIO_OK;
-  uint32_t pinMask = 0;
 
-  EALLOW;
-  //address of data register
-  volatile uint32_t *data_reg;
-  data_reg = data_reg = (uint32_t *)GPIO_DATA_REG_F2877S + ((pin / 32) * GPY_DATA_OFFSET);
-  pinMask = 1UL << (pin % 32);
-  data_reg = data_reg + GPYTOGGLE;
-  *data_reg |= pinMask;
+  if((uint32_t)port < GPIO_NUMBER_OF_PORTS)
+  {
+    volatile uint32_t *data_reg = GPIO_PORT_REGISTER(port);
+
+    data_reg[GPIO_PORT_SET] = value & mask;
+    data_reg[GPIO_PORT_CLEAR] = ~value & mask;
+  }
+  else
+  {
+    ret = E_GPIO_INVALID_PARAM;
+  }
 
   return ret;
 }
 
-uint32_t pinGPIORead(uint32_t pin)
+uint32_t portGPIORead(GPIOPort_Type port)
 {
-  uint32_t state;
+  uint32_t state = 0;
 
-  EALLOW;
-  //address of data register
-  volatile uint32_t *data_reg;
-  data_reg = data_reg = (uint32_t *)GPIO_DATA_REG_F2877S + ((pin / 32) * GPY_DATA_OFFSET);
-
-  state = (data_reg[GPYDAT] >> (pin % 32)) & 0x1;
+  if((uint32_t)port < GPIO_NUMBER_OF_PORTS)
+  {
+    state = GPIO_PORT_REGISTER(port)[GPIO_PORT_DAT];
+  }
 
-  EDIS;
   return state;
 }
 
+err pinGPIOListMask(const uint32_t *pins, uint16_t number, GPIOPortMask_Type *ports)
+{
+  err ret = E_GPIO_OK;
+  uint16_t i = 0;
+
+  for(i = 0; i < GPIO_NUMBER_OF_PORTS; i++)
+  {
+    ports->mask[i] = 0;
+  }
+
+  for(i = 0; i < number; i++)
+  {
+    if(pins[i] < GPIO_NUMBER_OF_PINS)
+    {
+      ports->mask[pins[i] / 32] |= 1UL << (pins[i] % 32);
+    }
+    else
+    {
+      ret = E_GPIO_INVALID_PARAM;
+    }
+  }
+
+  return ret;
+}
+
+void portGPIOMaskSet(const GPIOPortMask_Type *ports)
+{
+  GPIO_PORT_MASK_WRITE(ports, GPIO_PORT_SET);
+}
+
+void portGPIOMaskClear(const GPIOPortMask_Type *ports)
+{
+  GPIO_PORT_MASK_WRITE(ports, GPIO_PORT_CLEAR);
+}
+
+void portGPIOMaskToogle(const GPIOPortMask_Type *ports)
+{
+  GPIO_PORT_MASK_WRITE(ports, GPIO_PORT_TOGGLE);
+}
+
 err pinLOCKset(uint32_t pin, GPIOLock_Type lock)
 {
   err ret = E_GPIO_OK;
@@ -445,8 +558,7 @@ err pinLOCKset(uint32_t pin, GPIOLock_Type lock)
 
   pinMask = (1UL << pin32);               //make mask of for one bit in register
 
-  volatile uint32_t *lock_reg = NULL;
-  GPIO_LOCK_REGISTER(pin, lock_reg);    //get address of lock register
+  volatile uint32_t *lock_reg = GPIO_LOCK_REGISTER(pin);    //get address of lock register
 
   EALLOW;
   if(lock == LOCK_Enable)
@@ -23,6 +23,35 @@ typedef int err;
 #define E_GPIO_NOT_INITIALIZE   -1                   //GPIO not initialized
 #define E_GPIO_INVALID_PARAM    -2                   //Invalid input parameters
 
+/**
+ * @brief Hardware parameters of GPIO used by validation of config
+ */
+#define GPIO_NUMBER_OF_PINS               168     //number of pins
+#define GPIO_SAMPLING_PERIOD_DIVIDER      256     //number of sampling period dividers, 8-bit QUALPRDx field
+#define GPIO_NUMBER_OF_PORTS              6       //number of ports, A - F
+
+/**
+ * @brief Offset of data registers at GPIO port, in 32-bit registers from GPxDAT
+ */
+#define GPIO_PORT_DAT                     0       //GPxDAT
+#define GPIO_PORT_SET                     1       //GPxSET, write-only
+#define GPIO_PORT_CLEAR                   2       //GPxCLEAR, write-only
+#define GPIO_PORT_TOGGLE                  3       //GPxTOGGLE, write-only
+
+/**
+ * @brief Index of control register at image of port (GPIOPortImage_Type), in order of write
+ */
+#define GPIO_IMG_CTRL                     0       //GPxCTRL
+#define GPIO_IMG_QSEL                     1       //GPxQSEL1, GPxQSEL2
+#define GPIO_IMG_GMUX                     3       //GPxGMUX1, GPxGMUX2, written before GPxMUX
+#define GPIO_IMG_MUX                      5       //GPxMUX1, GPxMUX2
+#define GPIO_IMG_CSEL                     7       //GPxCSEL1 - GPxCSEL4
+#define GPIO_IMG_ODR                      11      //GPxODR
+#define GPIO_IMG_PUD                      12      //GPxPUD
+#define GPIO_IMG_INV                      13      //GPxINV
+#define GPIO_IMG_DIR                      14      //GPxDIR, at the end when output is ready
+#define GPIO_IMG_NUMBER                   15
+
 /**
  * @brief Numeric representation state of pin
  */
@@ -32,6 +61,23 @@ typedef enum
   GPIO_RESET               //reset state of specific pin
 } GPIOSet_Type;
 
+/**
+ * @brief Numeric representation of GPIO port, 32 pins at each port
+ */
+typedef enum
+{
+  PORT_MIN = -1,              //Not related to GPIO, for debug purpose
+
+  PORT_A,                     //GPIO0 to 31
+  PORT_B,                     //GPIO32 to 63
+  PORT_C,                     //GPIO64 to 95
+  PORT_D,                     //GPIO96 to 127
+  PORT_E,                     //GPIO128 to 159
+  PORT_F,                     //GPIO160 to 168
+  PORT_MAX                    //Not related to GPIO, for debug purpose
+
+} GPIOPort_Type;
+
 /**
  * brief Input qualification type:
  */
@@ -209,6 +255,262 @@ typedef struct
 
 } GPIOCfg_Type;
 
+/**
+ * @brief Handle of pin with precomputed data register and mask. Initialized once by pinGPIOHandle(),
+ * then every set, clear and toggle is a single 32-bit store.
+ */
+typedef struct
+{
+    volatile uint32_t *data;      //GPxDAT of port where pin is. GPxSET, GPxCLEAR, GPxTOGGLE are next
+    uint32_t mask;                //mask of pin at port registers
+} GPIOPin_Type;
+
+/**
+ * @brief Masks of pins at every port, index is GPIOPort_Type. Made by pinGPIOListMask() and used by
+ * portGPIOMask* functions, which write only ports with not empty mask.
+ */
+typedef struct
+{
+    uint32_t mask[GPIO_NUMBER_OF_PORTS];
+} GPIOPortMask_Type;
+
+/**
+ * @brief New value of part of one control register
+ */
+typedef struct
+{
+    uint32_t clear;               //bits of register which are changed
+    uint32_t set;                 //new value of changed bits
+} GPIORegImage_Type;
+
+/**
+ * @brief New values of control registers of one port, index of register is GPIO_IMG_*. Only registers
+ * marked at 'used' are valid.
+ */
+typedef struct
+{
+    uint16_t used;                                //bit 'n' - register 'n' is changed
+    GPIORegImage_Type reg[GPIO_IMG_NUMBER];
+} GPIOPortImage_Type;
+
+/**
+ * @brief Precomputed values of control registers of all ports, made at compile time by GPIO_MAP_IMAGE
+ */
+typedef struct
+{
+    GPIOPortImage_Type port[GPIO_NUMBER_OF_PORTS];
+} GPIOMapImage_Type;
+
+/**
+ * @brief Range check of enum from config, valid values are between MIN and MAX (both not included)
+ */
+#define GPIO_IN_RANGE(value, max)     ((uint32_t)(value) - 1UL < (uint32_t)(max) - 1UL)
+
+/**
+ * @brief Validation of all fields of config, without loops and branches. Value is a constant expression
+ * if all parameters are constant, so can be used at compile time.
+ *
+ * @return 1 - config is valid, 0 - config is invalid
+ */
+#define GPIO_CFG_IS_VALID(pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  (((uint32_t)(pin) < GPIO_NUMBER_OF_PINS) &                                                                           \
+   ((uint32_t)(samplingPeriod) < GPIO_SAMPLING_PERIOD_DIVIDER) &                                                       \
+   GPIO_IN_RANGE(pinFunction, MUX_MAX) &                                                                               \
+   GPIO_IN_RANGE(samplingQualification, QSEL_MAX) &                                                                    \
+   GPIO_IN_RANGE(direction, DIR_MAX) &                                                                                 \
+   GPIO_IN_RANGE(pull, PUD_MAX) &                                                                                      \
+   GPIO_IN_RANGE(invert, INV_MAX) &                                                                                    \
+   GPIO_IN_RANGE(type, ODR_MAX) &                                                                                      \
+   GPIO_IN_RANGE(core, CORE_MAX))
+
+/**
+ * @brief Define const config validated at compile time. Invalid config stop compilation with error
+ * about negative size of array 'name_invalid_gpio_config'. Config defined by this macro should be
+ * applied by pinGPIOCfgStatic(), which do not validate it again. i.e:
+ *
+ *   GPIO_CFG_STATIC(ledPin, 12, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1);
+ *   pinGPIOCfgStatic(&ledPin);
+ */
+#define GPIO_CFG_STATIC(name, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  typedef char name##_invalid_gpio_config[GPIO_CFG_IS_VALID(pin, samplingPeriod, pinFunction, samplingQualification,        \
+                                                            direction, pull, invert, type, core) ? 1 : -1];                 \
+  const GPIOCfg_Type name = { pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core }
+
+/**
+ * @brief Entry of const board pin map validated at compile time. Invalid entry stop compilation with error
+ * about negative size of array. Map defined by this macro should be applied by pinGPIOCfgMapStatic(). i.e:
+ *
+ *   const GPIOCfg_Type boardPins[] =
+ *   {
+ *     GPIO_PIN_MAP_ENTRY(12, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1),
+ *     GPIO_PIN_MAP_ENTRY(58, 0, MUX_15, QSEL_Async, DIR_Input, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1),
+ *   };
+ */
+#define GPIO_PIN_MAP_ENTRY(pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  { (pin) + 0 * (int32_t)sizeof(char[GPIO_CFG_IS_VALID(pin, samplingPeriod, pinFunction, samplingQualification,            \
+                                                        direction, pull, invert, type, core) ? 1 : -1]),                    \
+    samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core }
+
+/**
+ * @brief Compile-time pin map generator. Board is described once by list macro, which call X for every pin
+ * with two context arguments 'a' and 'b' passed through:
+ *
+ *   #define BOARD_PINS(X, a, b)                                                                                        \
+ *     X(a, b, 12, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)        \
+ *     X(a, b, 58, 0, MUX_15, QSEL_Async, DIR_Input, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)
+ *
+ *   GPIO_MAP_IMAGE(boardImage, BOARD_PINS);          //register values of all ports, in flash
+ *   GPIO_MAP_TABLE(boardPins, BOARD_PINS);           //the same map as GPIOCfg_Type array, i.e for pinGPIOCfgMapStatic()
+ *   GPIO_MAP_CPU1_PIN(ledPin, BOARD_PINS, 12);       //pin 12 is driven by CPU1 code
+ *
+ *   pinGPIOCfgImage(&boardImage);
+ *
+ * Compilation stops with error about negative size of array if:
+ *   'name_invalid_gpio_config'        - any pin config is invalid
+ *   'name_pin_conflict'               - pin is described twice, i.e with two functions
+ *   'name_sampling_period_conflict'   - pins of the same 8-pin group have different samplingPeriod, they share
+ *                                       one QUALPRDx field of GPxCTRL
+ *   'name_cla_pin_with_peripheral'    - pin owned by CLA has peripheral function, so it is driven by CPU1 peripheral
+ *   'name_cla_pin_driven_by_cpu1'     - pin checked by GPIO_MAP_CPU1_PIN is owned by CLA
+ */
+#define GPIO_MAP_PIN32(pin)           ((uint32_t)(pin) % 32)
+#define GPIO_MAP_BIT(pin)             (1UL << GPIO_MAP_PIN32(pin))
+#define GPIO_MAP_SHIFT2(pin)          (2 * ((uint32_t)(pin) % 16))
+
+/**
+ * @brief Mask of field of pin at control register 'index', 0 if pin has no field at this register
+ */
+#define GPIO_MAP_MASK(index, pin, direction)                                                                    \
+  (((index) == GPIO_IMG_CTRL) ? (0xFFUL << (8 * (GPIO_MAP_PIN32(pin) / 8))) :                                    \
+   (((index) == GPIO_IMG_QSEL + GPIO_MAP_PIN32(pin) / 16) || ((index) == GPIO_IMG_GMUX + GPIO_MAP_PIN32(pin) / 16) || \
+    ((index) == GPIO_IMG_MUX + GPIO_MAP_PIN32(pin) / 16)) ? (0x3UL << GPIO_MAP_SHIFT2(pin)) :                    \
+   ((index) == GPIO_IMG_CSEL + GPIO_MAP_PIN32(pin) / 8) ? (0xFUL << (4 * ((uint32_t)(pin) % 8))) :               \
+   (((index) == GPIO_IMG_PUD) || ((index) == GPIO_IMG_DIR)) ? GPIO_MAP_BIT(pin) :                               \
+   ((index) == GPIO_IMG_ODR) ? (((direction) == DIR_Output) ? GPIO_MAP_BIT(pin) : 0UL) :                        \
+   ((index) == GPIO_IMG_INV) ? (((direction) == DIR_Output) ? 0UL : GPIO_MAP_BIT(pin)) : 0UL)
+
+/**
+ * @brief Value of field of pin at control register 'index', the same as GPIO_PIN_FIELD_LIST() at DriverGPIO.c
+ */
+#define GPIO_MAP_VALUE(index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  (((index) == GPIO_IMG_CTRL) ? (((uint32_t)(samplingPeriod) & 0xFFUL) << (8 * (GPIO_MAP_PIN32(pin) / 8))) :          \
+   ((index) == GPIO_IMG_QSEL + GPIO_MAP_PIN32(pin) / 16) ?                                                          \
+     (((uint32_t)(samplingQualification) - 1) << GPIO_MAP_SHIFT2(pin)) :                                            \
+   ((index) == GPIO_IMG_GMUX + GPIO_MAP_PIN32(pin) / 16) ?                                                          \
+     ((((uint32_t)(pinFunction) - 1) >> 2) << GPIO_MAP_SHIFT2(pin)) :                                               \
+   ((index) == GPIO_IMG_MUX + GPIO_MAP_PIN32(pin) / 16) ?                                                           \
+     ((((uint32_t)(pinFunction) - 1) & 0x3UL) << GPIO_MAP_SHIFT2(pin)) :                                            \
+   ((index) == GPIO_IMG_CSEL + GPIO_MAP_PIN32(pin) / 8) ?                                                           \
+     ((((core) == CORE_CLA) ? 1UL : 0UL) << (4 * ((uint32_t)(pin) % 8))) :                                          \
+   ((index) == GPIO_IMG_PUD) ? (((pull) == PUD_Enable) ? 0UL : GPIO_MAP_BIT(pin)) :                                \
+   ((index) == GPIO_IMG_DIR) ? (((direction) == DIR_Output) ? GPIO_MAP_BIT(pin) : 0UL) :                           \
+   ((index) == GPIO_IMG_ODR) ? ((((direction) == DIR_Output) && ((type) == ODR_OpenDrainOutput)) ? GPIO_MAP_BIT(pin) : 0UL) : \
+   ((index) == GPIO_IMG_INV) ? ((((direction) != DIR_Output) && ((invert) == INV_InvertEnable)) ? GPIO_MAP_BIT(pin) : 0UL) : 0UL)
+
+/**
+ * @brief Registers of port changed by config of pin, bit 'n' is register with index 'n'
+ */
+#define GPIO_MAP_USED(pin, direction)                                                                           \
+  ((1U << GPIO_IMG_CTRL) | (1U << (GPIO_IMG_QSEL + GPIO_MAP_PIN32(pin) / 16)) |                                 \
+   (1U << (GPIO_IMG_GMUX + GPIO_MAP_PIN32(pin) / 16)) | (1U << (GPIO_IMG_MUX + GPIO_MAP_PIN32(pin) / 16)) |    \
+   (1U << (GPIO_IMG_CSEL + GPIO_MAP_PIN32(pin) / 8)) | (1U << GPIO_IMG_PUD) | (1U << GPIO_IMG_DIR) |           \
+   (1U << (((direction) == DIR_Output) ? GPIO_IMG_ODR : GPIO_IMG_INV)))
+
+/**
+ * @brief X macros called by list of pins, 'port' and 'index' are context arguments
+ */
+#define GPIO_MAP_CLEAR_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) / 32 == (port)) ? GPIO_MAP_MASK(index, pin, direction) : 0UL)
+
+#define GPIO_MAP_SET_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) / 32 == (port)) ? GPIO_MAP_VALUE(index, pin, samplingPeriod, pinFunction, samplingQualification,     \
+                                                         direction, pull, invert, type, core) : 0UL)
+
+#define GPIO_MAP_USED_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) / 32 == (port)) ? GPIO_MAP_USED(pin, direction) : 0U)
+
+#define GPIO_MAP_VALID_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  & GPIO_CFG_IS_VALID(pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core)
+
+#define GPIO_MAP_SUM_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  + (((uint32_t)(pin) / 32 == (port)) ? (1ULL << GPIO_MAP_PIN32(pin)) : 0ULL)
+
+#define GPIO_MAP_OR_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) / 32 == (port)) ? (1ULL << GPIO_MAP_PIN32(pin)) : 0ULL)
+
+#define GPIO_MAP_CLA_MUX_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((core) == CORE_CLA) && ((pinFunction) != MUX_0))
+
+#define GPIO_MAP_CLA_PIN_X(checked, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) == (uint32_t)(checked)) && ((core) == CORE_CLA))
+
+#define GPIO_MAP_PERIOD_OR_X(group, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  | (((uint32_t)(pin) / 8 == (group)) ? ((uint32_t)(samplingPeriod) & 0xFFUL) : 0UL)
+
+#define GPIO_MAP_PERIOD_AND_X(group, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  & (((uint32_t)(pin) / 8 == (group)) ? ((uint32_t)(samplingPeriod) & 0xFFUL) : 0xFFUL)
+
+#define GPIO_MAP_TABLE_X(port, index, pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core) \
+  GPIO_PIN_MAP_ENTRY(pin, samplingPeriod, pinFunction, samplingQualification, direction, pull, invert, type, core),
+
+/**
+ * @brief Every pin of port is described once, if sum of bits of pins is equal to logical or of them
+ */
+#define GPIO_MAP_UNIQUE(list, port)   ((0ULL list(GPIO_MAP_SUM_X, port, 0)) == (0ULL list(GPIO_MAP_OR_X, port, 0)))
+
+/**
+ * @brief Pins of 8-pin group share QUALPRDx, so they have the same samplingPeriod if logical or of periods has
+ * no bit which is not at logical and of them. Group without pins gives 0 and 0xFF.
+ */
+#define GPIO_MAP_PERIOD_SAME(list, group)                                                                       \
+  (((0UL list(GPIO_MAP_PERIOD_OR_X, group, 0)) & ~(0xFFUL list(GPIO_MAP_PERIOD_AND_X, group, 0))) == 0UL)
+
+#define GPIO_MAP_PERIOD_PORT(list, port)                                                                        \
+  (GPIO_MAP_PERIOD_SAME(list, 4 * (port)) && GPIO_MAP_PERIOD_SAME(list, 4 * (port) + 1) &&                     \
+   GPIO_MAP_PERIOD_SAME(list, 4 * (port) + 2) && GPIO_MAP_PERIOD_SAME(list, 4 * (port) + 3))
+
+#define GPIO_MAP_REG(list, port, index)                                                                         \
+  { 0UL list(GPIO_MAP_CLEAR_X, port, index), 0UL list(GPIO_MAP_SET_X, port, index) }
+
+#define GPIO_MAP_PORT(list, port)                                                                               \
+  { (uint16_t)(0U list(GPIO_MAP_USED_X, port, 0)),                                                             \
+    { GPIO_MAP_REG(list, port, 0), GPIO_MAP_REG(list, port, 1), GPIO_MAP_REG(list, port, 2),                   \
+      GPIO_MAP_REG(list, port, 3), GPIO_MAP_REG(list, port, 4), GPIO_MAP_REG(list, port, 5),                   \
+      GPIO_MAP_REG(list, port, 6), GPIO_MAP_REG(list, port, 7), GPIO_MAP_REG(list, port, 8),                   \
+      GPIO_MAP_REG(list, port, 9), GPIO_MAP_REG(list, port, 10), GPIO_MAP_REG(list, port, 11),                 \
+      GPIO_MAP_REG(list, port, 12), GPIO_MAP_REG(list, port, 13), GPIO_MAP_REG(list, port, 14) } }
+
+/**
+ * @brief Define const image of all control registers of board pin map, see description of generator above.
+ * Image should be applied by pinGPIOCfgImage().
+ */
+#define GPIO_MAP_IMAGE(name, list)                                                                              \
+  typedef char name##_invalid_gpio_config[(1 list(GPIO_MAP_VALID_X, 0, 0)) ? 1 : -1];                          \
+  typedef char name##_pin_conflict[(GPIO_MAP_UNIQUE(list, 0) && GPIO_MAP_UNIQUE(list, 1) &&                    \
+                                    GPIO_MAP_UNIQUE(list, 2) && GPIO_MAP_UNIQUE(list, 3) &&                    \
+                                    GPIO_MAP_UNIQUE(list, 4) && GPIO_MAP_UNIQUE(list, 5)) ? 1 : -1];           \
+  typedef char name##_sampling_period_conflict[(GPIO_MAP_PERIOD_PORT(list, 0) && GPIO_MAP_PERIOD_PORT(list, 1) && \
+                                                GPIO_MAP_PERIOD_PORT(list, 2) && GPIO_MAP_PERIOD_PORT(list, 3) && \
+                                                GPIO_MAP_PERIOD_PORT(list, 4) && GPIO_MAP_PERIOD_PORT(list, 5)) ? 1 : -1]; \
+  typedef char name##_cla_pin_with_peripheral[(0 list(GPIO_MAP_CLA_MUX_X, 0, 0)) ? -1 : 1];                    \
+  const GPIOMapImage_Type name =                                                                                \
+  {                                                                                                             \
+    { GPIO_MAP_PORT(list, 0), GPIO_MAP_PORT(list, 1), GPIO_MAP_PORT(list, 2),                                  \
+      GPIO_MAP_PORT(list, 3), GPIO_MAP_PORT(list, 4), GPIO_MAP_PORT(list, 5) }                                 \
+  }
+
+/**
+ * @brief Define const array of GPIOCfg_Type from list of pins, i.e for pinGPIOCfgMapStatic()
+ */
+#define GPIO_MAP_TABLE(name, list)                                                                              \
+  const GPIOCfg_Type name[] = { list(GPIO_MAP_TABLE_X, 0, 0) }
+
+/**
+ * @brief Check at compile time that pin driven by CPU1 code (i.e by GPIOPin_Type handle) is not owned by CLA
+ */
+#define GPIO_MAP_CPU1_PIN(name, list, pin)                                                                      \
+  typedef char name##_cla_pin_driven_by_cpu1[(0 list(GPIO_MAP_CLA_PIN_X, pin, 0)) ? -1 : 1]
+
 /**
  * @brief Function used to config specific pin by settings from structure
  *
@@ -219,6 +521,55 @@ typedef struct
 err
 pinGPIOCfg(GPIOCfg_Type* gpio);
 
+/**
+ * @brief Function used to config specific pin by const config validated at compile time by GPIO_CFG_STATIC.
+ * Config is not validated at runtime.
+ *
+ * @param const GPIOCfg_Type* gpio - pointer to config structure defined by GPIO_CFG_STATIC
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOCfgStatic(const GPIOCfg_Type* gpio);
+
+/**
+ * @brief Function used to config all pins from board pin map. Configs of pins which share a control
+ * register are merged, so every control register is written once (GPxMUX twice, to switch pins to
+ * GPIO before GPxGMUX is changed) in any order of map. Map is read once for every port with pins, so
+ * map sorted by port is the fastest. Map should be const, so it is placed at flash. Nothing is
+ * configured if any entry is invalid.
+ *
+ * @param const GPIOCfg_Type *map - array of configs of pins
+ * @param uint16_t number - number of configs at map
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOCfgMap(const GPIOCfg_Type *map, uint16_t number);
+
+/**
+ * @brief Function used to config all pins from board pin map defined by GPIO_PIN_MAP_ENTRY. Map is not
+ * validated at runtime.
+ *
+ * @param const GPIOCfg_Type *map - array of configs of pins
+ * @param uint16_t number - number of configs at map
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOCfgMapStatic(const GPIOCfg_Type *map, uint16_t number);
+
+/**
+ * @brief Function used to config pins by image precomputed at compile time by GPIO_MAP_IMAGE. Only stores
+ * of ready values and masks, one EALLOW for each used port.
+ *
+ * @param const GPIOMapImage_Type *image - image defined by GPIO_MAP_IMAGE
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOCfgImage(const GPIOMapImage_Type *image);
+
 /**
  * @brief Function used to change state specific pin.
  *
@@ -258,4 +609,155 @@ pinGPIORead(uint32_t pin);
  */
 err
 pinGPIOToogle(uint32_t pin);
+
+/**
+ * @brief Function used to set all pins from mask at one port by single write
+ *
+ * @param GPIOPort_Type port - port of pins
+ * @param uint32_t mask - mask of pins at port, bit 0 is first pin of port
+ *
+ * @return Status of operation
+ */
+err
+portGPIOSet(GPIOPort_Type port, uint32_t mask);
+
+/**
+ * @brief Function used to reset all pins from mask at one port by single write
+ *
+ * @param GPIOPort_Type port - port of pins
+ * @param uint32_t mask - mask of pins at port, bit 0 is first pin of port
+ *
+ * @return Status of operation
+ */
+err
+portGPIOClear(GPIOPort_Type port, uint32_t mask);
+
+/**
+ * @brief Function used to toogle all pins from mask at one port by single write
+ *
+ * @param GPIOPort_Type port - port of pins
+ * @param uint32_t mask - mask of pins at port, bit 0 is first pin of port
+ *
+ * @return Status of operation
+ */
+err
+portGPIOToogle(GPIOPort_Type port, uint32_t mask);
+
+/**
+ * @brief Function used to write value to pins from mask at one port. Bits of value which are set go to
+ * GPxSET and bits which are reset go to GPxCLEAR, other pins of port are not changed.
+ *
+ * @param GPIOPort_Type port - port of pins
+ * @param uint32_t mask - mask of pins at port which are written
+ * @param uint32_t value - new state of pins
+ *
+ * @return Status of operation
+ */
+err
+portGPIOWrite(GPIOPort_Type port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Function used to read state of all pins at one port by single read
+ *
+ * @param GPIOPort_Type port - port of pins
+ *
+ * @return State of pins, bit 0 is first pin of port. 0 if port is invalid
+ */
+uint32_t
+portGPIORead(GPIOPort_Type port);
+
+/**
+ * @brief Function used to split list of pins to masks of ports
+ *
+ * @param const uint32_t *pins - list of pins
+ * @param uint16_t number - number of pins at list
+ * @param GPIOPortMask_Type *ports - masks of ports
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOListMask(const uint32_t *pins, uint16_t number, GPIOPortMask_Type *ports);
+
+/**
+ * @brief Function used to set pins from masks, one write for each port with not empty mask
+ *
+ * @param const GPIOPortMask_Type *ports - masks of ports made by pinGPIOListMask()
+ */
+void
+portGPIOMaskSet(const GPIOPortMask_Type *ports);
+
+/**
+ * @brief Function used to reset pins from masks, one write for each port with not empty mask
+ *
+ * @param const GPIOPortMask_Type *ports - masks of ports made by pinGPIOListMask()
+ */
+void
+portGPIOMaskClear(const GPIOPortMask_Type *ports);
+
+/**
+ * @brief Function used to toogle pins from masks, one write for each port with not empty mask
+ *
+ * @param const GPIOPortMask_Type *ports - masks of ports made by pinGPIOListMask()
+ */
+void
+portGPIOMaskToogle(const GPIOPortMask_Type *ports);
+
+/**
+ * @brief Function used to resolve data register and mask of pin. Result can be used by pinGPIOHandle*
+ * functions, also from ISR.
+ *
+ * @param uint32_t pin - number of specific pin
+ * @param GPIOPin_Type *handle - pointer to handle which is initialized
+ *
+ * @return Status of operation
+ */
+err
+pinGPIOHandle(uint32_t pin, GPIOPin_Type *handle);
+
+/**
+ * @brief Function used to set pin by handle. Single store to GPxSET.
+ *
+ * @param const GPIOPin_Type *handle - handle initialized by pinGPIOHandle()
+ */
+static inline void
+pinGPIOHandleSet(const GPIOPin_Type *handle)
+{
+  handle->data[GPIO_PORT_SET] = handle->mask;
+}
+
+/**
+ * @brief Function used to reset pin by handle. Single store to GPxCLEAR.
+ *
+ * @param const GPIOPin_Type *handle - handle initialized by pinGPIOHandle()
+ */
+static inline void
+pinGPIOHandleClear(const GPIOPin_Type *handle)
+{
+  handle->data[GPIO_PORT_CLEAR] = handle->mask;
+}
+
+/**
+ * @brief Function used to toogle pin by handle. Single store to GPxTOGGLE.
+ *
+ * @param const GPIOPin_Type *handle - handle initialized by pinGPIOHandle()
+ */
+static inline void
+pinGPIOHandleToogle(const GPIOPin_Type *handle)
+{
+  handle->data[GPIO_PORT_TOGGLE] = handle->mask;
+}
+
+/**
+ * @brief Function used to read state of pin by handle
+ *
+ * @param const GPIOPin_Type *handle - handle initialized by pinGPIOHandle()
+ *
+ * @return 1 - pin is high, 0 - pin is low
+ */
+static inline uint32_t
+pinGPIOHandleRead(const GPIOPin_Type *handle)
+{
+  return (handle->data[GPIO_PORT_DAT] & handle->mask) ? 1 : 0;
+}
+
 #endif /* DRIVERGPIO_H_ */
@@ -4,116 +4,1033 @@
  * @Created on: 28 sie 2018
  * @Author: KamilM
  *
- * @brief Source file of abstract SPI driver working at tms320F28377S. All of SPI work with DMA
+ * @brief Source file of abstract SPI driver working at tms320F28377S. All of SPI work with DMA and share
+ * the same code, registers and DMA channels of SPI are taken from SPI_INSTANCES table
  */
 #include "F2837xS_device.h"
 #include "DriverSPI.h"
+#include "DriverDMA.h"
+
+#define SPI_NUMBER                   3
+
+/**
+ * @brief Bits of SPI FIFO registers
+ */
+#define SPI_FIFO_DEPTH               16
+#define SPI_FFTX_ENABLE              0xE000    //SPIRST, SPIFFENA, TXFIFO reset released
+#define SPI_FFTX_OFF                 0xA000    //FIFO disabled, reset value
+#define SPI_FFTX_RESET               0xC000    //SPIRST, SPIFFENA, TXFIFO kept at reset
+#define SPI_FFTX_ST_SHIFT            8
+#define SPI_FFTX_ST_MASK             0x1F00
+#define SPI_FFTX_INTCLR              0x0040
+#define SPI_FFTX_IENA                0x0020
+#define SPI_FFRX_OVF                 0x8000
+#define SPI_FFRX_OVFCLR              0x4000
+#define SPI_FFRX_ENABLE              0x2000    //RXFIFO reset released
+#define SPI_FFRX_ST_SHIFT            8
+#define SPI_FFRX_ST_MASK             0x1F00
+#define SPI_FFRX_INTCLR              0x0040
+#define SPI_FFRX_IENA                0x0020
+
+/**
+ * @brief Bits of SPI control registers
+ */
+#define SPI_CCR_SPICHAR              0x000F
+#define SPI_CCR_SPILBK               0x0010
+#define SPI_CCR_HS_MODE              0x0020
+#define SPI_CCR_CLKPOLARITY          0x0040
+#define SPI_CCR_SPISWRESET           0x0080
+#define SPI_CTL_TALK                 0x0002
+#define SPI_CTL_MASTER               0x0004
+#define SPI_CTL_CLK_PHASE            0x0008
+#define SPI_STS_INT_FLAG             0x0040
+#define SPI_BAUD_MIN                 3
+#define SPI_BAUD_MAX                 127
+
+/**
+ * @brief Clock tree
+ */
+#define SPI_OSCCLK_INTOSC2           0         //CLKSRCCTL1.OSCCLKSRCSEL
+#define SPI_OSCCLK_XTAL              1
+#define SPI_INTOSC_FREQ              10000000UL
+
+#define SPI_DUMMY_WORD               0xFFFF    //word sent during read
+
+/**
+ * @brief Hardware resources of one SPI, all SPI share the same code working at this table
+ */
+typedef struct
+{
+  volatile struct SPI_REGS *regs;
+  uint16_t clock;                  //bit of SPI at PCLKCR8
+  uint16_t txTrigger;              //SPITXDMAx, DMA_TRIGGER_SPI_TX
+  uint16_t rxTrigger;              //SPIRXDMAx, DMA_TRIGGER_SPI_RX
+  volatile PINT *fifoRxVector;     //PIE vectors of FIFO, group 6
+  volatile PINT *fifoTxVector;
+  PINT fifoRxIsr;
+  PINT fifoTxIsr;
+  uint16_t fifoPieMask;            //bits of FIFO RX and TX at PIEIER6
+} SPI_Instance;
+
+/**
+ * @brief State of transfer of SPI
+ */
+typedef struct
+{
+  uint16_t burst;                  //words moved at each DMA request, 0 - SPI is not configured for DMA
+  uint16_t dma;                    //DMA channels are allocated from DMA driver
+  DMA_ChannelType txChannel;       //DMA channel which write SPITXBUF, valid if dma
+  DMA_ChannelType rxChannel;       //DMA channel which read SPIRXBUF
+  uint32_t dmaOverflow;            //overflows of RX channel counted by DMA driver and already added to stats
+  uint16_t fifoLvl;                //watermark of FIFO engine, 0 - FIFO is disabled
+  volatile uint16_t busy;          //buffs are owned by driver
+  uint16_t fifo;                   //transfer is done by FIFO interrupts, not by DMA
+  SPI_Callback callback;
+
+  //transfer of FIFO engine, indexes are changed only by ISR when transfer is started
+  uint16_t *sendbuff;
+  uint16_t *readbuff;
+  uint16_t length;
+  uint16_t txIndex;                //words written to TX FIFO
+  uint16_t rxIndex;                //words read from RX FIFO
+  SPI_Stats stats;
+
+  //slave stream, ring of two blocks filled by DMA
+  uint16_t stream;                 //stream is running
+  uint16_t *ring;
+  uint16_t block;                  //length of block
+  uint16_t next;                   //block which is filled by the next DMA transfer
+  uint16_t started;                //the first transfer is started
+  volatile uint16_t owned[2];      //block is notified and not released by application
+  SPI_StreamCallback streamCallback;
+
+  //frame pipeline, queue of frames filled by DMA, head is changed only by ISR and tail only by application
+  uint16_t frame;                  //pipeline is running
+  SPI_Frame *frames;
+  uint16_t mask;                   //depth of queue - 1
+  volatile uint16_t head;          //frame being filled by DMA, frames before it are published
+  volatile uint16_t tail;          //the oldest published frame
+  uint32_t sequence;
+  volatile uint32_t *clock;
+  SPI_Callback frameCallback;
+
+  //shadow of SPI_Cfg and of SPICCR, SPICTL, SPIBRR, so settings are written only when changed
+  uint16_t configured;
+  SPI_Cfg cfg;
+  uint16_t ccr;
+  uint16_t ctl;
+  uint16_t brr;
+} SPI_State;
+
+static void SPI_DMA_CALLBACK(DMA_ChannelType channel);
+static __interrupt void SPIA_RX_ISR(void);
+static __interrupt void SPIA_TX_ISR(void);
+static __interrupt void SPIB_RX_ISR(void);
+static __interrupt void SPIB_TX_ISR(void);
+static __interrupt void SPIC_RX_ISR(void);
+static __interrupt void SPIC_TX_ISR(void);
+
+static const SPI_Instance SPI_INSTANCES[SPI_NUMBER] =
+{
+  { &SpiaRegs, 0x0001, DMA_TRIGGER_SPI_TX(0), DMA_TRIGGER_SPI_RX(0),
+    &PieVectTable.SPIA_RX_INT, &PieVectTable.SPIA_TX_INT, &SPIA_RX_ISR, &SPIA_TX_ISR, 0x0003 },         //INT6.1, INT6.2
+  { &SpibRegs, 0x0002, DMA_TRIGGER_SPI_TX(1), DMA_TRIGGER_SPI_RX(1),
+    &PieVectTable.SPIB_RX_INT, &PieVectTable.SPIB_TX_INT, &SPIB_RX_ISR, &SPIB_TX_ISR, 0x000C },         //INT6.3, INT6.4
+  { &SpicRegs, 0x0004, DMA_TRIGGER_SPI_TX(2), DMA_TRIGGER_SPI_RX(2),
+    &PieVectTable.SPIC_RX_INT, &PieVectTable.SPIC_TX_INT, &SPIC_RX_ISR, &SPIC_TX_ISR, 0x0300 },         //INT6.9, INT6.10
+};
+
+static SPI_State spiState[SPI_NUMBER];
+static uint16_t spiIrq;            //end of transfer is reported by interrupt
+
+//DMA can access only GS RAM, so dummy word is written once by SPI_DMA_INIT() instead of constant at flash
+#pragma DATA_SECTION(spiDmaSink, "ramgs_dma")
+static uint16_t spiDmaSink[SPI_NUMBER];   //destination of dropped words at send, one for each SPI
+#pragma DATA_SECTION(spiDmaDummy, "ramgs_dma")
+static uint16_t spiDmaDummy;              //source of dummy words at read, never changed after SPI_DMA_INIT()
 
 //******************************************************STATIC FUNCTION**************************************************
 
-static err_spi SPI_CHECK(SPI_Cfg *config)
+static err_spi SPI_CHECK(const SPI_Cfg *config)
+{
+  err_spi ret = E_SPI_OK;
+
+  //the same validation as SPI_CFG_STATIC uses at compile time
+  if((config == NULL) ||
+     !SPI_CFG_IS_VALID(config->spi, config->mode, config->polarity, config->word_size, config->baud_rate, config->phase,
+                       config->fifo_set, config->fifo_lvl))
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+
+  return ret;
+}
+
+static void SPI_SETUP_FIFO(volatile struct SPI_REGS *regs, const SPI_Cfg *config)
+{
+  //SPI FIFO can resume, enable FIFO TX, interrupt lvl bits
+  regs->SPIFFTX.all = ((0xE000) | (uint16_t)config->fifo_lvl);
+
+  //interrupt RX lvl bits
+  regs->SPIFFRX.all = ((0x0000) | (uint16_t)config->fifo_lvl);
+
+  //no transmit delay
+  regs->SPIFFCT.all = 0x00;
+
+  //release transmit FIFO from reset
+  regs->SPIFFTX.bit.TXFIFO = 1;
+
+  //re-enable RX FIFO operation
+  regs->SPIFFRX.bit.RXFIFORESET = 1;
+}
+
+/**
+ * @brief Static function used to write SPICCR, SPICTL and SPIBRR. Only registers which differ from shadow are
+ * written. SPI is reset only if polarity of clock, high speed mode or SPICTL (phase, master/slave) is changed,
+ * word size and bit rate are changed without reset.
+ */
+static void SPI_WRITE(volatile struct SPI_REGS *regs, SPI_State *state, uint16_t ccr, uint16_t ctl, uint16_t brr,
+                      uint16_t force)
+{
+  if(force || (((ccr ^ state->ccr) & (SPI_CCR_CLKPOLARITY | SPI_CCR_HS_MODE)) != 0) || (ctl != state->ctl))
+  {
+    regs->SPICCR.all = ccr & ~SPI_CCR_SPISWRESET;     //reset SPI
+    regs->SPICTL.all = ctl;
+    if(force || (brr != state->brr))
+    {
+      regs->SPIBRR.all = brr;
+    }
+    regs->SPICCR.all = ccr;                           //enable SPI
+  }
+  else
+  {
+    if(ccr != state->ccr)
+    {
+      regs->SPICCR.all = ccr;
+    }
+    if(brr != state->brr)
+    {
+      regs->SPIBRR.all = brr;
+    }
+  }
+
+  state->ccr = ccr;
+  state->ctl = ctl;
+  state->brr = brr;
+}
+
+/**
+ * @brief Static function used to configure SPI. At first call whole SPI is written, next calls write only
+ * fields which differ from shadow of SPI_Cfg.
+ */
+static void SPI_CONFIG(const SPI_Instance *instance, SPI_State *state, const SPI_Cfg *config, uint16_t first, uint16_t fifo)
+{
+  volatile struct SPI_REGS *regs = instance->regs;
+  uint16_t ccr = SPI_CCR_SPISWRESET | (uint16_t)config->word_size | ((config->polarity == POL_FALLING) ? SPI_CCR_CLKPOLARITY : 0) |
+                 (state->ccr & (SPI_CCR_HS_MODE | SPI_CCR_SPILBK));    //changed only by spiBaudSet() and spiLoopback()
+  uint16_t ctl = SPI_CTL_TALK | ((config->mode == MODE_MASTER) ? SPI_CTL_MASTER : 0) |
+                 ((config->phase == PHA_DELAY) ? SPI_CTL_CLK_PHASE : 0);
+
+  //bit rate is used only if SPI work as master
+  uint16_t brr = (config->mode == MODE_MASTER) ? config->baud_rate : state->brr;
+
+  if(first)
+  {
+    EALLOW;
+    CpuSysRegs.PCLKCR8.all |= instance->clock;      //clock of SPI
+    EDIS;
+  }
+
+  if(fifo)
+  {
+    if(config->fifo_set == FIFO_ON)
+    {
+      //config FIFO for RX and TX
+      SPI_SETUP_FIFO(regs, config);
+    }
+    else
+    {
+      regs->SPIFFTX.all = SPI_FFTX_OFF;
+    }
+  }
+
+  SPI_WRITE(regs, state, ccr, ctl, brr, first);
+}
+
+/**
+ * @brief Static function used to allocate DMA channels of SPI from DMA driver and enable DMA access to SPI.
+ * Any channel can serve SPI, so dmaAlloc() is used and DMA_CH1 is left for scheduler (DriverDMASched.h).
+ * Channels are programmed by dmaStart() at every transfer and kept until FIFO settings without DMA are applied.
+ *
+ * @return 1 - channels are owned by SPI, 0 - there are no free channels
+ */
+static uint16_t SPI_DMA_INIT(SPI_State *state)
+{
+  if(!state->dma)
+  {
+    if(dmaAlloc(&state->txChannel) != E_DMA_OK)
+    {
+      return 0;
+    }
+    if(dmaAlloc(&state->rxChannel) != E_DMA_OK)
+    {
+      dmaFree(state->txChannel);
+      return 0;
+    }
+    state->dma = 1;
+  }
+
+  spiDmaDummy = SPI_DUMMY_WORD;
+
+  EALLOW;
+  CpuSysRegs.SECMSEL.bit.PF2SEL = 1;        //SPI is at peripheral frame 2, DMA is master of it
+  EDIS;
+
+  return 1;
+}
+
+/**
+ * @brief Static function used to return DMA channels of SPI to DMA driver, interrupt of channel is disabled
+ * by dmaFree()
+ */
+static void SPI_DMA_RELEASE(SPI_State *state)
+{
+  if(state->dma)
+  {
+    dmaFree(state->txChannel);
+    dmaFree(state->rxChannel);
+    state->dma = 0;
+  }
+}
+
+/**
+ * @brief Static function used to fill descriptor of one SPI transfer, step 0 is used for SPI register and
+ * dummy word. Trigger, mode and callback are set by caller.
+ */
+static void SPI_DMA_TRANSFER(DMA_Transfer *transfer, const volatile void *source, int16_t sourceStep,
+                             volatile void *destination, int16_t destinationStep, uint16_t burst, uint16_t transfers)
+{
+  transfer->source = source;
+  transfer->destination = destination;
+  transfer->burst = burst;
+  transfer->srcBurstStep = sourceStep;
+  transfer->dstBurstStep = destinationStep;
+  transfer->transfers = transfers;
+  transfer->srcTransferStep = sourceStep;
+  transfer->dstTransferStep = destinationStep;
+  transfer->srcWrap = DMA_WRAP_NONE;
+  transfer->srcWrapStep = 0;
+  transfer->dstWrap = DMA_WRAP_NONE;
+  transfer->dstWrapStep = 0;
+  transfer->trigger = DMA_TRIGGER_SOFTWARE;
+  transfer->size = DMA_SIZE_16;
+  transfer->mode = DMA_TRANSFER_BURST;
+  transfer->callback = NULL;
+}
+
+/**
+ * @brief Static function used to read overflows of RX channel counted by DMA driver
+ */
+static uint32_t SPI_DMA_LOST(DMA_ChannelType channel)
+{
+  DMA_Stats stats;
+
+  stats.overflow = 0;
+  (void)dmaStats(channel, &stats);
+
+  return stats.overflow;
+}
+
+/**
+ * @brief Static function used to start transfer. NULL buff is changed to dummy word.
+ */
+static err_spi SPI_DMA_START(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length)
+{
+  err_spi ret = E_SPI_OK;
+  SPI_State *state = NULL;
+  const SPI_Instance *instance = NULL;
+  volatile struct SPI_REGS *regs = NULL;
+  DMA_Transfer transfer;
+  uint16_t transfers = 0;
+
+  if((uint32_t)spi >= SPI_NUMBER)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  state = &spiState[spi];
+  instance = &SPI_INSTANCES[spi];
+  regs = instance->regs;
+
+  if(state->burst == 0)
+  {
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else if((length == 0) || (length % state->burst != 0))
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    transfers = length / state->burst;
+    state->fifo = 0;
+    state->busy = 1;
+
+    //FIFO engine changes levels and interrupts of FIFO, DMA is triggered by level equal to burst
+    regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    regs->SPIFFRX.all = SPI_FFRX_ENABLE | state->burst;
+    regs->SPIFFTX.all = SPI_FFTX_ENABLE | SPI_FFTX_INTCLR | state->burst;
+
+    //receive is ready before first word is sent
+    SPI_DMA_TRANSFER(&transfer, &regs->SPIRXBUF, 0, (readbuff != NULL) ? readbuff : &spiDmaSink[spi],
+                     (readbuff != NULL) ? 1 : 0, state->burst, transfers);
+    transfer.trigger = instance->rxTrigger;
+    transfer.callback = spiIrq ? &SPI_DMA_CALLBACK : NULL;
+
+    if(dmaStart(state->rxChannel, &transfer) != E_DMA_OK)
+    {
+      ret = E_SPI_BUSY;
+    }
+    else
+    {
+      SPI_DMA_TRANSFER(&transfer, (sendbuff != NULL) ? sendbuff : &spiDmaDummy, (sendbuff != NULL) ? 1 : 0,
+                       &regs->SPITXBUF, 0, state->burst, transfers);
+      transfer.trigger = instance->txTrigger;
+
+      if(dmaStart(state->txChannel, &transfer) != E_DMA_OK)
+      {
+        (void)dmaStop(state->rxChannel);
+        ret = E_SPI_BUSY;
+      }
+    }
+
+    if(ret != E_SPI_OK)
+    {
+      state->busy = 0;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Static function used to finish transfer of DMA or FIFO engine
+ */
+static void SPI_DONE(SPIType spi)
+{
+  SPI_State *state = &spiState[spi];
+
+  state->busy = 0;
+  if(state->callback != NULL)
+  {
+    state->callback(spi);
+  }
+}
+
+/**
+ * @brief Static function used to add peripheral events lost by RX channel of stream or frame pipeline. OVRFLG
+ * is cleared and counted by ISR of DMA driver, so it is read only by spiStats() and at stop, not at every ISR.
+ */
+static void SPI_DMA_OVERFLOW(SPI_State *state)
+{
+  uint32_t lost = SPI_DMA_LOST(state->rxChannel);
+
+  state->stats.overflow += lost - state->dmaOverflow;
+  state->dmaOverflow = lost;
+}
+
+/**
+ * @brief Static function used to drop transfer or to stop stream or frame pipeline, channels get trigger of SPI
+ * again at the next dmaStart(). Transfer of FIFO engine is dropped by disabled FIFO interrupts and reset FIFOs,
+ * because FIFO registers are written by spiCfg() only when FIFO settings are changed.
+ */
+static void SPI_DMA_HALT(volatile struct SPI_REGS *regs, SPI_State *state)
+{
+  if(state->stream || state->frame)
+  {
+    SPI_DMA_OVERFLOW(state);
+  }
+
+  if(state->busy && state->fifo)
+  {
+    regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    regs->SPIFFRX.all = SPI_FFRX_ENABLE | SPI_FFRX_INTCLR;
+    regs->SPIFFTX.all = SPI_FFTX_RESET | SPI_FFTX_INTCLR;
+    regs->SPIFFTX.all = SPI_FFTX_ENABLE | SPI_FFTX_INTCLR;
+  }
+
+  if(state->dma)
+  {
+    (void)dmaStop(state->rxChannel);
+    (void)dmaStop(state->txChannel);
+  }
+
+  state->stream = 0;
+  state->frame = 0;
+  state->busy = 0;
+}
+
+/**
+ * @brief Static function used to count words lost by RX FIFO of stream or frame pipeline
+ */
+static void SPI_FIFO_OVERFLOW(volatile struct SPI_REGS *regs, SPI_State *state)
+{
+  if(regs->SPIFFRX.all & SPI_FFRX_OVF)
+  {
+    regs->SPIFFRX.bit.RXFFOVFCLR = 1;
+    state->stats.overflow++;
+  }
+}
+
+/**
+ * @brief Static function called by ISR of DMA at the start of every transfer of stream. DMA copied shadow
+ * address to active one, so shadow is changed to the other block for the next transfer and the block
+ * filled by previous transfer is notified.
+ */
+static void SPI_STREAM_BLOCK(SPIType spi)
+{
+  const SPI_Instance *instance = &SPI_INSTANCES[spi];
+  SPI_State *state = &spiState[spi];
+  uint16_t filling = state->next;               //block which DMA started to fill
+  uint16_t *address = state->ring + (filling ^ 1) * state->block;
+
+  (void)dmaNextDestination(state->rxChannel, address);
+  SPI_FIFO_OVERFLOW(instance->regs, state);
+
+  state->next = filling ^ 1;
+
+  if(state->started)
+  {
+    //application still processes block which is overwritten now
+    if(state->owned[filling])
+    {
+      state->stats.overrun++;
+    }
+
+    state->stats.blocks++;
+    state->owned[filling ^ 1] = 1;
+    state->streamCallback(spi, address, filling ^ 1);
+  }
+  state->started = 1;
+}
+
+/**
+ * @brief Static function called by ISR of DMA at the end of every frame of pipeline. Frame is published if
+ * queue has place for it and shadow address is changed to the next frame, else the same frame is filled
+ * again by the next transfer.
+ */
+static void SPI_FRAME_DONE(SPIType spi)
+{
+  const SPI_Instance *instance = &SPI_INSTANCES[spi];
+  SPI_State *state = &spiState[spi];
+  SPI_Frame *frame = &state->frames[state->head & state->mask];
+  uint16_t *next = NULL;
+
+  frame->timestamp = (state->clock != NULL) ? *state->clock : 0;
+  frame->sequence = state->sequence++;
+
+  SPI_FIFO_OVERFLOW(instance->regs, state);
+
+  if((uint16_t)(state->head + 1 - state->tail) <= state->mask)
+  {
+    next = state->frames[(state->head + 1) & state->mask].samples;
+    (void)dmaNextDestination(state->rxChannel, next);
+
+    //frame is published after it is complete
+    state->head++;
+    state->stats.frames++;
+    if(state->frameCallback != NULL)
+    {
+      state->frameCallback(spi);
+    }
+  }
+  else
+  {
+    state->stats.overrun++;
+  }
+}
+
+/**
+ * @brief Static function called by ISR of DMA at the end of read
+ */
+static void SPI_DMA_DONE(SPIType spi)
+{
+  if(spiState[spi].stream)
+  {
+    SPI_STREAM_BLOCK(spi);
+  }
+  else if(spiState[spi].frame)
+  {
+    SPI_FRAME_DONE(spi);
+  }
+  else
+  {
+    SPI_DONE(spi);
+  }
+}
+
+/**
+ * @brief Static function called by DMA driver from ISR of RX channel, PIE is acknowledged by DMA driver
+ */
+static void SPI_DMA_CALLBACK(DMA_ChannelType channel)
+{
+  uint16_t i = 0;
+
+  for(i = 0; i < SPI_NUMBER; i++)
+  {
+    if(spiState[i].dma && (spiState[i].rxChannel == channel))
+    {
+      SPI_DMA_DONE((SPIType)i);
+    }
+  }
+}
+
+/**
+ * @brief Static function used to read all words from RX FIFO, words are dropped if there is no readbuff
+ */
+static void SPI_FIFO_DRAIN(volatile struct SPI_REGS *regs, SPI_State *state, uint16_t count)
+{
+  uint16_t *read = state->readbuff;
+  uint16_t index = state->rxIndex;
+  uint16_t i = 0;
+
+  if(read != NULL)
+  {
+    for(i = 0; i < count; i++)
+    {
+      read[index++] = regs->SPIRXBUF;
+    }
+  }
+  else
+  {
+    for(i = 0; i < count; i++)
+    {
+      (void)regs->SPIRXBUF;
+    }
+    index += count;
+  }
+  state->rxIndex = index;
+}
+
+/**
+ * @brief Static function used to write TX FIFO. When words are read, FIFO is refilled by RX ISR and words at
+ * TX FIFO, at shift register and at RX FIFO are never more than depth of FIFO, so RX FIFO can not overflow.
+ * When words are only sent, FIFO is refilled by TX ISR at watermark and RX FIFO is drained by the same ISR.
+ * After the last word is written, end of transfer is reported by RX ISR when the last word is received, so
+ * chip select can be released at once.
+ */
+static void SPI_FIFO_FILL(volatile struct SPI_REGS *regs, SPI_State *state)
+{
+  uint16_t index = state->txIndex;
+  uint16_t left = state->length - index;
+  uint16_t *send = state->sendbuff;
+  uint16_t count = 0;
+  uint16_t control = SPI_FFTX_ENABLE | SPI_FFTX_INTCLR;
+
+  if(state->readbuff != NULL)
+  {
+    count = SPI_FIFO_DEPTH - (index - state->rxIndex);
+  }
+  else
+  {
+    count = SPI_FIFO_DEPTH - ((regs->SPIFFTX.all & SPI_FFTX_ST_MASK) >> SPI_FFTX_ST_SHIFT);
+  }
+
+  if(count > left)
+  {
+    count = left;
+  }
+
+  if(send != NULL)
+  {
+    for(left = 0; left < count; left++)
+    {
+      regs->SPITXBUF = send[index++];
+    }
+  }
+  else
+  {
+    for(left = 0; left < count; left++)
+    {
+      regs->SPITXBUF = SPI_DUMMY_WORD;
+    }
+    index += count;
+  }
+  state->txIndex = index;
+
+  if(state->readbuff == NULL)
+  {
+    if(index < state->length)
+    {
+      control |= SPI_FFTX_IENA | state->fifoLvl;
+    }
+    else
+    {
+      //RX ISR waits for not received words, batch is not bigger than FIFO
+      count = index - state->rxIndex;
+      regs->SPIFFRX.all = SPI_FFRX_ENABLE | SPI_FFRX_INTCLR | SPI_FFRX_IENA |
+                          ((count < SPI_FIFO_DEPTH) ? count : SPI_FIFO_DEPTH);
+    }
+  }
+  regs->SPIFFTX.all = control;
+}
+
+/**
+ * @brief Static function called by RX ISR when FIFO has watermark words. Whole FIFO is read at once.
+ */
+static void SPI_FIFO_RX(SPIType spi)
+{
+  volatile struct SPI_REGS *regs = SPI_INSTANCES[spi].regs;
+  SPI_State *state = &spiState[spi];
+  uint16_t status = regs->SPIFFRX.all;
+  uint16_t left = 0;
+  uint16_t control = SPI_FFRX_ENABLE | SPI_FFRX_INTCLR;
+
+  //request was pending at PIE when transfer was dropped
+  if(!state->busy || !state->fifo)
+  {
+    PieCtrlRegs.PIEACK.all = M_INT6;
+    return;
+  }
+
+  state->stats.rxIsr++;
+  if(status & SPI_FFRX_OVF)
+  {
+    state->stats.overflow++;
+    control |= SPI_FFRX_OVFCLR;
+  }
+
+  SPI_FIFO_DRAIN(regs, state, (status & SPI_FFRX_ST_MASK) >> SPI_FFRX_ST_SHIFT);
+
+  left = state->length - state->rxIndex;
+  if(left == 0)
+  {
+    regs->SPIFFRX.all = control;          //RX interrupt disabled
+    SPI_DONE(spi);
+  }
+  else
+  {
+    //the last batch can be shorter than watermark
+    regs->SPIFFRX.all = control | SPI_FFRX_IENA | ((left < state->fifoLvl) ? left : state->fifoLvl);
+    SPI_FIFO_FILL(regs, state);
+  }
+
+  PieCtrlRegs.PIEACK.all = M_INT6;
+}
+
+/**
+ * @brief Static function called by TX ISR when TX FIFO has watermark words or less, used only when words
+ * are not read
+ */
+static void SPI_FIFO_TX(SPIType spi)
+{
+  volatile struct SPI_REGS *regs = SPI_INSTANCES[spi].regs;
+  SPI_State *state = &spiState[spi];
+
+  //request was pending at PIE when transfer was dropped
+  if(!state->busy || !state->fifo)
+  {
+    PieCtrlRegs.PIEACK.all = M_INT6;
+    return;
+  }
+
+  state->stats.txIsr++;
+
+  //received words are dropped before RX FIFO is full
+  SPI_FIFO_DRAIN(regs, state, (regs->SPIFFRX.all & SPI_FFRX_ST_MASK) >> SPI_FFRX_ST_SHIFT);
+  SPI_FIFO_FILL(regs, state);
+
+  PieCtrlRegs.PIEACK.all = M_INT6;
+}
+
+static __interrupt void SPIA_RX_ISR(void)
+{
+  SPI_FIFO_RX(SPI_A);
+}
+
+static __interrupt void SPIA_TX_ISR(void)
+{
+  SPI_FIFO_TX(SPI_A);
+}
+
+static __interrupt void SPIB_RX_ISR(void)
+{
+  SPI_FIFO_RX(SPI_B);
+}
+
+static __interrupt void SPIB_TX_ISR(void)
+{
+  SPI_FIFO_TX(SPI_B);
+}
+
+static __interrupt void SPIC_RX_ISR(void)
+{
+  SPI_FIFO_RX(SPI_C);
+}
+
+static __interrupt void SPIC_TX_ISR(void)
+{
+  SPI_FIFO_TX(SPI_C);
+}
+
+/**
+ * @brief Static function used to install FIFO ISR of SPI and enable PIE group 6
+ */
+static void SPI_FIFO_INIT(const SPI_Instance *instance)
+{
+  EALLOW;
+  *instance->fifoRxVector = instance->fifoRxIsr;
+  *instance->fifoTxVector = instance->fifoTxIsr;
+  EDIS;
+
+  PieCtrlRegs.PIEIER6.all |= instance->fifoPieMask;
+  IER |= M_INT6;
+}
+
+/**
+ * @brief Static function used to apply validated config. Running stream or frame pipeline is stopped and FIFO, DMA and
+ * interrupts of FIFO are initialized again only if FIFO settings are changed.
+ */
+static void SPI_APPLY(const SPI_Cfg *config)
+{
+  const SPI_Instance *instance = &SPI_INSTANCES[config->spi];
+  SPI_State *state = &spiState[config->spi];
+  uint16_t first = !state->configured;
+  uint16_t fifo = first || (config->fifo_set != state->cfg.fifo_set) || (config->fifo_lvl != state->cfg.fifo_lvl);
+
+  //transfer is dropped
+  if(state->busy)
+  {
+    SPI_DMA_HALT(instance->regs, state);
+  }
+
+  SPI_CONFIG(instance, state, config, first, fifo);     //configure and enable SPI
+
+  if(fifo)
+  {
+    //DMA move burst of fifo_lvl words, so FIFO is needed
+    if((config->fifo_set == FIFO_ON) && (config->fifo_lvl >= FIFO_LVL_1) && (config->fifo_lvl <= SPI_DMA_BURST_MAX) &&
+       SPI_DMA_INIT(state))
+    {
+      state->burst = (uint16_t)config->fifo_lvl;
+    }
+    else
+    {
+      SPI_DMA_RELEASE(state);
+      state->burst = 0;
+    }
+
+    //FIFO engine needs watermark bigger than 0
+    if((config->fifo_set == FIFO_ON) && (config->fifo_lvl >= FIFO_LVL_1))
+    {
+      state->fifoLvl = (uint16_t)config->fifo_lvl;
+      SPI_FIFO_INIT(instance);
+    }
+    else
+    {
+      state->fifoLvl = 0;
+    }
+  }
+
+  state->cfg = *config;
+  state->configured = 1;
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+
+err_spi spiCfg(SPI_Cfg *config)
+{
+  err_spi ret = E_SPI_OK;
+
+  //check correctness of struct parameters
+  if(SPI_CHECK(config) != E_SPI_OK)
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    SPI_APPLY(config);
+  }
+
+  return ret;
+}
+
+err_spi spiCfgStatic(const SPI_CfgImage *image)
+{
+  SPI_State *state = NULL;
+
+  if(image == NULL)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  //config is validated at compile time by SPI_CFG_STATIC
+  state = &spiState[image->cfg.spi];
+
+  if(state->configured && !state->stream && !state->frame && (image->cfg.fifo_set == state->cfg.fifo_set) &&
+     (image->cfg.fifo_lvl == state->cfg.fifo_lvl))
+  {
+    //transfer is dropped
+    if(state->busy)
+    {
+      SPI_DMA_HALT(SPI_INSTANCES[image->cfg.spi].regs, state);
+    }
+
+    //high speed and loopback mode are changed only by spiBaudSet() and spiLoopback()
+    SPI_WRITE(SPI_INSTANCES[image->cfg.spi].regs, state, image->ccr | (state->ccr & (SPI_CCR_HS_MODE | SPI_CCR_SPILBK)),
+              image->ctl, image->brr, 0);
+    state->cfg = image->cfg;
+  }
+  else
+  {
+    SPI_APPLY(&image->cfg);
+  }
+
+  return E_SPI_OK;
+}
+
+err_spi spiSend(SPIType spi, uint16_t *sendbuff, uint16_t length)
+{
+  return (sendbuff != NULL) ? SPI_DMA_START(spi, sendbuff, NULL, length) : E_SPI_INVALID_PARAM;
+}
+
+err_spi spiRead(SPIType spi, uint16_t *readbuff, uint16_t length)
+{
+  return (readbuff != NULL) ? SPI_DMA_START(spi, NULL, readbuff, length) : E_SPI_INVALID_PARAM;
+}
+
+err_spi spiTransfer(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length)
 {
-  err_spi ret = E_SPI_OK;
-  uint32_t a = 0;
+  return ((sendbuff != NULL) && (readbuff != NULL)) ? SPI_DMA_START(spi, sendbuff, readbuff, length) : E_SPI_INVALID_PARAM;
+}
 
-  //check correctness of spi type
-  int spi = -1;
-  for(a = SPI_MIN + 1;a < SPI_MAX; a++)
+uint16_t spiBusy(SPIType spi)
+{
+  SPI_State *state = NULL;
+
+  if((uint32_t)spi >= SPI_NUMBER)
   {
-    if(config->spi == a)
-    {
-      spi = a;
-      break;
-    }
+    return 0;
   }
 
-  //check correctness of mode type
-  int mode = -1;
-  for(a = MODE_MIN + 1;a < MODE_MAX; a++)
+  state = &spiState[spi];
+
+  //without interrupt the end of transfer is when receive channel is stopped
+  if(state->busy && !state->fifo && !state->stream && !state->frame && !spiIrq && !dmaBusy(state->rxChannel))
   {
-    if(config->mode == a)
-    {
-      mode = a;
-      break;
-    }
+    state->busy = 0;
   }
 
-  int baudrate = 0;
-  if(config->mode == MODE_MASTER)
+  return state->busy;
+}
+
+err_spi spiAbort(SPIType spi)
+{
+  err_spi ret = E_SPI_OK;
+
+  if(((uint32_t)spi >= SPI_NUMBER) || spiState[spi].stream || spiState[spi].frame)
   {
-    baudrate = -1;
-    for(a = 3 ;a < 129; a++)
-    {
-      if(config->baud_rate == a)
-      {
-        baudrate = a;
-        break;
-      }
-    }
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else if(spiState[spi].busy)
+  {
+    SPI_DMA_HALT(SPI_INSTANCES[spi].regs, &spiState[spi]);
   }
 
+  return ret;
+}
+
+err_spi spiCallback(SPIType spi, SPI_Callback callback)
+{
+  err_spi ret = E_SPI_OK;
 
-  //check correctness of polarity
-  int pol = -1;
-  for(a = POL_MIN + 1;a < POL_MAX; a++)
+  if((uint32_t)spi < SPI_NUMBER)
   {
-    if(config->polarity == a)
-    {
-      pol = a;
-      break;
-    }
+    spiState[spi].callback = callback;
   }
-
-  //check correctness of word size
-  int word = -1;
-  for(a = WORD_MIN + 1;a < WORD_MAX; a++)
+  else
   {
-    if(config->word_size == a)
-    {
-      word = a;
-      break;
-    }
+    ret = E_SPI_INVALID_PARAM;
   }
 
-  //check correctness of phase
-  int phase = -1;
-  for(a = PHA_MIN + 1;a < PHA_MAX; a++)
+  return ret;
+}
+
+void spiIRQ_ReadEnable(void)
+{
+  //callback of RX channel is given to DMA driver by next transfers
+  spiIrq = 1;
+}
+
+void spiIRQ_ReadDisable(void)
+{
+  spiIrq = 0;
+}
+
+err_spi spiTransferFIFO(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length)
+{
+  err_spi ret = E_SPI_OK;
+  volatile struct SPI_REGS *regs = NULL;
+  SPI_State *state = NULL;
+
+  if((uint32_t)spi >= SPI_NUMBER)
   {
-    if(config->phase == a)
-    {
-      phase = a;
-      break;
-    }
+    return E_SPI_INVALID_PARAM;
   }
 
-  //check correctness of FIFO enabled
-  int fifo = -1;
-  for(a = FIFO_MIN + 1;a < FIFO_MAX; a++)
+  regs = SPI_INSTANCES[spi].regs;
+  state = &spiState[spi];
+
+  if(state->fifoLvl == 0)
   {
-    if(config->word_size == a)
-    {
-      fifo = a;
-      break;
-    }
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else if((length == 0) || ((sendbuff == NULL) && (readbuff == NULL)))
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    state->sendbuff = sendbuff;
+    state->readbuff = readbuff;
+    state->length = length;
+    state->txIndex = 0;
+    state->rxIndex = 0;
+    state->fifo = 1;
+    state->busy = 1;
+
+    //RX FIFO is cleared before first word is sent, RX interrupt is used only when words are read
+    regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    regs->SPIFFRX.all = SPI_FFRX_ENABLE | ((readbuff != NULL) ? SPI_FFRX_IENA : 0) |
+                        ((length < state->fifoLvl) ? length : state->fifoLvl);
+    SPI_FIFO_FILL(regs, state);
   }
 
-  int fifolvl = 0;
-  //if fifo is enabled
-  if(config->fifo_set == FIFO_ON)
+  return ret;
+}
+
+err_spi spiStats(SPIType spi, SPI_Stats *stats)
+{
+  err_spi ret = E_SPI_OK;
+
+  if(((uint32_t)spi < SPI_NUMBER) && (stats != NULL))
   {
-    //check correctness of FIFO enabled
-    fifolvl = -1;
-    for(a = FIFO_LVLMIN + 1;a < FIFO_LVLMAX; a++)
+    if(spiState[spi].stream || spiState[spi].frame)
     {
-      if(config->fifo_lvl == a)
-      {
-        fifolvl = a;
-        break;
-      }
+      SPI_DMA_OVERFLOW(&spiState[spi]);
     }
+    *stats = spiState[spi].stats;
   }
-
-  if( !((spi >= 0) && (mode >= 0) && (pol >= 0) && (word >=0) && (phase >= 0) && (fifo >= 0) && (fifolvl >= 0) && (baudrate >= 0) ))
+  else
   {
     ret = E_SPI_INVALID_PARAM;
   }
@@ -121,155 +1038,522 @@ static err_spi SPI_CHECK(SPI_Cfg *config)
   return ret;
 }
 
-static void SPIA_SETUP_FIFO(SPI_Cfg *config)
+err_spi spiDmaChannels(SPIType spi, DMA_ChannelType *tx, DMA_ChannelType *rx)
 {
-  //enable FIFO TX, interrupt lvl bits
-  SpiaRegs.SPIFFTX.all = ((0x6000) | (uint16_t)config->fifo_lvl);
+  SPI_State *state = NULL;
 
-  //interrupt RX lvl bits
-  SpiaRegs.SPIFFRX.all = ((0x0000) | (uint16_t)config->fifo_lvl);
+  if(((uint32_t)spi >= SPI_NUMBER) || (tx == NULL) || (rx == NULL))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
 
-  //no transmit delay
-  SpiaRegs.SPIFFCT.all = 0x00;
+  state = &spiState[spi];
+  if(!state->dma)
+  {
+    return E_SPI_NOT_INITIALIZE;
+  }
 
-  //release transmit FIFO from reset
-  SpiaRegs.SPIFFTX.bit.TXFIFO = 1;
+  *tx = state->txChannel;
+  *rx = state->rxChannel;
+  return E_SPI_OK;
+}
 
-  //re-enable RX FIFO operation
-  SpiaRegs.SPIFFRX.bit.RXFIFORESET = 1;
+err_spi spiBusSet(SPIType spi, const SPI_BusCfg *bus)
+{
+  volatile struct SPI_REGS *regs = NULL;
+  SPI_State *state = NULL;
+  uint16_t ccr = 0;
+  uint16_t ctl = 0;
+
+  if(((uint32_t)spi >= SPI_NUMBER) || (bus == NULL) ||
+     ((uint32_t)bus->polarity >= POL_MAX) || ((uint32_t)bus->phase >= PHA_MAX) || ((uint32_t)bus->word_size >= WORD_MAX) ||
+     (bus->baud_rate < SPI_BAUD_MIN) || (bus->baud_rate > SPI_BAUD_MAX))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  regs = SPI_INSTANCES[spi].regs;
+  state = &spiState[spi];
+
+  //shadow of registers is valid only after spiCfg()
+  if(!state->configured)
+  {
+    return E_SPI_NOT_INITIALIZE;
+  }
+
+  if(state->busy)
+  {
+    return E_SPI_BUSY;
+  }
+
+  ccr = (state->ccr & ~(SPI_CCR_CLKPOLARITY | SPI_CCR_SPICHAR)) | (uint16_t)bus->word_size |
+        ((bus->polarity == POL_FALLING) ? SPI_CCR_CLKPOLARITY : 0);
+  ctl = (state->ctl & ~SPI_CTL_CLK_PHASE) | ((bus->phase == PHA_DELAY) ? SPI_CTL_CLK_PHASE : 0);
+
+  SPI_WRITE(regs, state, ccr, ctl, bus->baud_rate, 0);
+
+  //shadow of SPI_Cfg follows bus settings
+  state->cfg.polarity = bus->polarity;
+  state->cfg.phase = bus->phase;
+  state->cfg.word_size = bus->word_size;
+  state->cfg.baud_rate = bus->baud_rate;
+
+  return E_SPI_OK;
 }
 
-static void SPIA_SETUP_POLARITY(SPI_Cfg *config)
+uint32_t spiLSPCLK(void)
 {
-  if(config->polarity == POL_FALLING)
+  uint32_t osc = SPI_INTOSC_FREQ;
+  uint32_t sys = 0;
+  uint16_t div = ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV;
+  uint16_t lsp = ClkCfgRegs.LOSPCP.bit.LSPCLKDIV;
+
+  //INTOSC1 and INTOSC2 are 10 MHz
+  if(ClkCfgRegs.CLKSRCCTL1.bit.OSCCLKSRCSEL == SPI_OSCCLK_XTAL)
   {
-    SpiaRegs.SPICCR.bit.CLKPOLARITY = 1;
+    osc = SPI_XTAL_FREQ;
+  }
+
+  //PLL multiplier is IMULT + FMULT/4, divider of PLLSYSCLK is 1 or 2 * PLLSYSCLKDIV
+  if(ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN)
+  {
+    sys = (osc / 4) * (4 * (uint32_t)ClkCfgRegs.SYSPLLMULT.bit.IMULT + ClkCfgRegs.SYSPLLMULT.bit.FMULT);
   }
   else
   {
-    SpiaRegs.SPICCR.bit.CLKPOLARITY = 0;
+    sys = osc;
+  }
+  sys /= (div == 0) ? 1 : 2 * (uint32_t)div;
+
+  //LSPCLK is SYSCLK / 1 or SYSCLK / (2 * LSPCLKDIV)
+  return sys / ((lsp == 0) ? 1 : 2 * (uint32_t)lsp);
+}
+
+err_spi spiBaudDivider(uint32_t frequency, uint16_t *divider, uint32_t *achieved)
+{
+  uint32_t lspclk = spiLSPCLK();
+  uint32_t brr = 0;
+
+  //bit rate is from LSPCLK/128 to LSPCLK/4, so divider below is always from SPI_BAUD_MIN to SPI_BAUD_MAX
+  if((divider == NULL) || (frequency == 0) || (frequency < (lspclk + SPI_BAUD_MAX) / (SPI_BAUD_MAX + 1)) ||
+     (frequency > lspclk / (SPI_BAUD_MIN + 1)))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  //the smallest divider which does not exceed frequency, bit rate is LSPCLK / (SPIBRR + 1)
+  brr = (lspclk + frequency - 1) / frequency - 1;
+
+  *divider = (uint16_t)brr;
+  if(achieved != NULL)
+  {
+    *achieved = lspclk / (brr + 1);
   }
 
+  return E_SPI_OK;
 }
 
-static void SPIA_SETUP_WORDSIZE(SPI_Cfg *config)
+err_spi spiBaudSet(SPIType spi, uint32_t frequency, uint32_t *achieved)
 {
-  SpiaRegs.SPICCR.bit.SPICHAR = (uint16_t)config->word_size;
+  err_spi ret = E_SPI_OK;
+  SPI_State *state = NULL;
+  uint16_t divider = 0;
+  uint32_t rate = 0;
+  uint16_t ccr = 0;
+
+  if((uint32_t)spi >= SPI_NUMBER)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  state = &spiState[spi];
+
+  //bit rate is generated only by master, shadow of registers is valid only after spiCfg()
+  if(!state->configured || (state->cfg.mode != MODE_MASTER))
+  {
+    return E_SPI_NOT_INITIALIZE;
+  }
+
+  ret = spiBaudDivider(frequency, &divider, &rate);
+
+  if(ret != E_SPI_OK)
+  {
+    return ret;
+  }
+
+  if(state->busy)
+  {
+    return E_SPI_BUSY;
+  }
+
+  //bit rate above normal mode limit needs high speed mode
+  ccr = state->ccr & ~SPI_CCR_HS_MODE;
+  if(rate > SPI_NORMAL_FREQ_MAX)
+  {
+    ccr |= SPI_CCR_HS_MODE;
+  }
+
+  SPI_WRITE(SPI_INSTANCES[spi].regs, state, ccr, state->ctl, divider, 0);
+  state->cfg.baud_rate = divider;
+
+  if(achieved != NULL)
+  {
+    *achieved = rate;
+  }
+
+  return ret;
 }
 
-static void SPIA_SETUP_PHASE(SPI_Cfg *config)
+err_spi spiStreamStart(SPIType spi, uint16_t *ring, uint16_t block, SPI_StreamCallback callback)
 {
-  if(config->phase == PHA_DELAY)
+  err_spi ret = E_SPI_OK;
+  const SPI_Instance *instance = NULL;
+  SPI_State *state = NULL;
+  DMA_Transfer transfer;
+
+  if(((uint32_t)spi >= SPI_NUMBER) || (ring == NULL) || (callback == NULL))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  instance = &SPI_INSTANCES[spi];
+  state = &spiState[spi];
+
+  if((state->burst == 0) || (state->cfg.mode != MODE_SLAVE))
+  {
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else if((block == 0) || (block % state->burst != 0))
   {
-    SpiaRegs.SPICTL.bit.CLK_PHASE = 1;
+    ret = E_SPI_INVALID_PARAM;
   }
   else
   {
-    SpiaRegs.SPICTL.bit.CLK_PHASE = 0;
+    state->ring = ring;
+    state->block = block;
+    state->next = 0;
+    state->started = 0;
+    state->owned[0] = 0;
+    state->owned[1] = 0;
+    state->streamCallback = callback;
+    state->fifo = 0;
+    state->stream = 1;
+    state->busy = 1;
+
+    state->dmaOverflow = SPI_DMA_LOST(state->rxChannel);
+
+    //words received before start are dropped
+    instance->regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    instance->regs->SPIFFRX.all = SPI_FFRX_ENABLE | state->burst;
+
+    //one DMA transfer is one block, interrupt at start of transfer changes block of the next one
+    SPI_DMA_TRANSFER(&transfer, &instance->regs->SPIRXBUF, 0, ring, 1, state->burst, block / state->burst);
+    transfer.trigger = instance->rxTrigger;
+    transfer.mode = DMA_TRANSFER_CONTINUOUS | DMA_TRANSFER_INT_START;
+    transfer.callback = &SPI_DMA_CALLBACK;
+
+    if(dmaStart(state->rxChannel, &transfer) != E_DMA_OK)
+    {
+      state->stream = 0;
+      state->busy = 0;
+      ret = E_SPI_BUSY;
+    }
   }
 
+  return ret;
 }
 
-static void SPIA_SETUP_BITRATE(SPI_Cfg *config)
+err_spi spiStreamRelease(SPIType spi, uint16_t half)
 {
-  SpiaRegs.SPIBRR.bit.SPI_BIT_RATE = (uint16_t)config->baud_rate;
+  err_spi ret = E_SPI_OK;
+
+  if(((uint32_t)spi < SPI_NUMBER) && (half < 2))
+  {
+    spiState[spi].owned[half] = 0;
+  }
+  else
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+
+  return ret;
 }
 
-static void SPIA_SETUP_MODE(SPI_Cfg *config)
+err_spi spiStreamStop(SPIType spi)
 {
-  if(config->mode == MODE_MASTER)
+  err_spi ret = E_SPI_OK;
+
+  if(((uint32_t)spi >= SPI_NUMBER) || !spiState[spi].stream)
   {
-    SpiaRegs.SPICTL.bit.MASTER_SLAVE = 1;
+    ret = E_SPI_INVALID_PARAM;
   }
   else
   {
-    SpiaRegs.SPICTL.bit.MASTER_SLAVE = 0;
+    SPI_DMA_HALT(SPI_INSTANCES[spi].regs, &spiState[spi]);
   }
+
+  return ret;
 }
 
-static void SPIA_SET_RESET(uint16_t state)
+err_spi spiFrameStart(const SPI_FrameCfg *config)
 {
-  if(state == 0)
+  err_spi ret = E_SPI_OK;
+  const SPI_Instance *instance = NULL;
+  SPI_State *state = NULL;
+  DMA_Transfer transfer;
+  uint16_t frameWords = 0;
+  uint16_t i = 0;
+
+  if((config == NULL) || ((uint32_t)config->spi >= SPI_NUMBER) || (config->commands == NULL) ||
+     (config->pool == NULL) || (config->frames == NULL))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  instance = &SPI_INSTANCES[config->spi];
+  state = &spiState[config->spi];
+
+  if((state->burst == 0) || (state->cfg.mode != MODE_MASTER))
+  {
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(config->spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else if((config->trigger == 0) || (config->trigger > 0xFF) || (config->channels == 0) ||
+          (config->channels > SPI_FRAME_CHANNELS_MAX) || (config->channels % state->burst != 0) ||
+          (config->samples == 0) || (config->samples > 0x7FFF) || ((uint32_t)config->channels * config->samples > 0xFFFF) ||
+          (config->depth < 2) || ((config->depth & (config->depth - 1)) != 0))
   {
-    SpiaRegs.SPICCR.bit.SPISWRESET = 0;
+    ret = E_SPI_INVALID_PARAM;
   }
-  else if(state == 1)
+  else
   {
-    SpiaRegs.SPICCR.bit.SPISWRESET = 1;
+    frameWords = config->channels * config->samples;
+    for(i = 0; i < config->depth; i++)
+    {
+      config->frames[i].samples = config->pool + (uint32_t)i * frameWords;
+    }
+
+    state->frames = config->frames;
+    state->mask = config->depth - 1;
+    state->head = 0;
+    state->tail = 0;
+    state->sequence = 0;
+    state->clock = config->clock;
+    state->frameCallback = config->callback;
+    state->fifo = 0;
+    state->frame = 1;
+    state->busy = 1;
+
+    //words received before start are dropped, RX DMA is triggered by level equal to burst
+    instance->regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    instance->regs->SPIFFRX.all = SPI_FFRX_ENABLE | state->burst;
+    instance->regs->SPIFFTX.all = SPI_FFTX_ENABLE | SPI_FFTX_INTCLR | state->burst;
+
+    state->dmaOverflow = SPI_DMA_LOST(state->rxChannel);
+
+    //one transfer is one frame, step of samples moves word to row of its channel, wrap after scan moves to
+    //column of the next sample
+    SPI_DMA_TRANSFER(&transfer, &instance->regs->SPIRXBUF, 0, config->pool, (int16_t)config->samples,
+                     state->burst, frameWords / state->burst);
+    transfer.dstWrap = config->channels / state->burst;
+    transfer.dstWrapStep = 1;
+    transfer.trigger = instance->rxTrigger;
+    transfer.mode = DMA_TRANSFER_CONTINUOUS;
+    transfer.callback = &SPI_DMA_CALLBACK;
+
+    if(dmaStart(state->rxChannel, &transfer) != E_DMA_OK)
+    {
+      ret = E_SPI_BUSY;
+    }
+    else
+    {
+      //scan of channels is one burst at each event, commands are loaded from shadow again at each transfer
+      SPI_DMA_TRANSFER(&transfer, config->commands, 1, &instance->regs->SPITXBUF, 0, config->channels, 1);
+      transfer.trigger = config->trigger;
+      transfer.mode = DMA_TRANSFER_CONTINUOUS;
+
+      if(dmaStart(state->txChannel, &transfer) != E_DMA_OK)
+      {
+        (void)dmaStop(state->rxChannel);
+        ret = E_SPI_BUSY;
+      }
+    }
+
+    if(ret != E_SPI_OK)
+    {
+      state->frame = 0;
+      state->busy = 0;
+    }
   }
+
+  return ret;
 }
 
-static void SPIA_ENABLE_TALK(uint16_t talk)
+err_spi spiFrameGet(SPIType spi, SPI_Frame **frame)
 {
-  if(talk == 0)
+  SPI_State *state = NULL;
+
+  if(((uint32_t)spi >= SPI_NUMBER) || (frame == NULL))
   {
-    //disable talk
-    SpiaRegs.SPICTL.bit.TALK = 0;
+    return E_SPI_INVALID_PARAM;
   }
-  else if(talk == 1)
+
+  state = &spiState[spi];
+  if(state->head == state->tail)
   {
-    //enable talk
-    SpiaRegs.SPICTL.bit.TALK = 1;
+    return E_SPI_EMPTY;
   }
 
+  *frame = &state->frames[state->tail & state->mask];
+  return E_SPI_OK;
 }
 
-static void SPIA_CONFIG(SPI_Cfg *config)
+err_spi spiFrameRelease(SPIType spi)
 {
-  if(config->fifo_set == FIFO_ON)
+  SPI_State *state = NULL;
+
+  if((uint32_t)spi >= SPI_NUMBER)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  state = &spiState[spi];
+  if(state->head == state->tail)
   {
-    //config FIFO for RX and TX
-    SPIA_SETUP_FIFO(config);
+    return E_SPI_EMPTY;
   }
 
-  SPIA_SET_RESET(0);                //reset SPI
-  SPIA_SETUP_POLARITY(config);      //setup polatiry
-  SPIA_SETUP_WORDSIZE(config);      //setup word size
+  state->tail++;
+  return E_SPI_OK;
+}
+
+err_spi spiFrameStop(SPIType spi)
+{
+  err_spi ret = E_SPI_OK;
 
-  if(config->mode == MODE_MASTER)
+  if(((uint32_t)spi >= SPI_NUMBER) || !spiState[spi].frame)
   {
-    //setup bitrane olny if SPI work as master
-    SPIA_SETUP_BITRATE(config);
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    SPI_DMA_HALT(SPI_INSTANCES[spi].regs, &spiState[spi]);
   }
 
-  SPIA_SETUP_MODE(config);            //setup master or slave mode
-  SPIA_SETUP_PHASE(config);           //setup clock phase
-  SPIA_ENABLE_TALK(1);                //enable talk
-  SPIA_SET_RESET(1);                  //enable SPI
+  return ret;
 }
 
-//******************************************************INTERFACE FUNCTION************************************************
+err_spi spiLoopback(SPIType spi, uint16_t enable)
+{
+  err_spi ret = E_SPI_OK;
+  SPI_State *state = NULL;
 
+  if((uint32_t)spi >= SPI_NUMBER)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
 
-err_spi spiCfg(SPI_Cfg *config)
+  state = &spiState[spi];
+
+  if(!state->configured)
+  {
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else
+  {
+    //SPILBK is written without reset of SPI
+    SPI_WRITE(SPI_INSTANCES[spi].regs, state, enable ? (state->ccr | SPI_CCR_SPILBK) : (state->ccr & ~SPI_CCR_SPILBK),
+              state->ctl, state->brr, 0);
+  }
+
+  return ret;
+}
+
+err_spi spiTransferPolled(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length)
 {
   err_spi ret = E_SPI_OK;
+  volatile struct SPI_REGS *regs = NULL;
+  SPI_State *state = NULL;
+  uint16_t txIndex = 0;
+  uint16_t rxIndex = 0;
+  uint16_t count = 0;
+  uint16_t word = 0;
+
+  if((uint32_t)spi >= SPI_NUMBER)
+  {
+    return E_SPI_INVALID_PARAM;
+  }
 
-  switch(config->spi)
+  regs = SPI_INSTANCES[spi].regs;
+  state = &spiState[spi];
+
+  if(!state->configured)
+  {
+    ret = E_SPI_NOT_INITIALIZE;
+  }
+  else if(spiBusy(spi))
+  {
+    ret = E_SPI_BUSY;
+  }
+  else if((length == 0) || ((sendbuff == NULL) && (readbuff == NULL)))
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else if(state->cfg.fifo_set == FIFO_ON)
   {
-    case SPI_A:
+    regs->SPIFFRX.all = SPI_FFRX_OVFCLR | SPI_FFRX_INTCLR;
+    regs->SPIFFRX.all = SPI_FFRX_ENABLE | state->cfg.fifo_lvl;
+
+    //not more than FIFO depth words are in flight, so RX FIFO never overflows
+    while(rxIndex < length)
     {
-      //check correctness of struct parameters
-      if(SPI_CHECK(config) == 0)
+      while((txIndex < length) && ((uint16_t)(txIndex - rxIndex) < SPI_FIFO_DEPTH))
       {
-        SPIA_CONFIG(config);            //configure and enable SPI_A
+        regs->SPITXBUF = (sendbuff != NULL) ? sendbuff[txIndex] : SPI_DUMMY_WORD;
+        txIndex++;
       }
-      else
+
+      count = (regs->SPIFFRX.all & SPI_FFRX_ST_MASK) >> SPI_FFRX_ST_SHIFT;
+      for(; count > 0; count--)
       {
-        ret = E_SPI_INVALID_PARAM;
-        break;
+        word = regs->SPIRXBUF;
+        if(readbuff != NULL)
+        {
+          readbuff[rxIndex] = word;
+        }
+        rxIndex++;
       }
-      ret = E_SPI_OK;
-      break;
     }
-    case SPI_B:
-    case SPI_C:
+  }
+  else
+  {
+    for(rxIndex = 0; rxIndex < length; rxIndex++)
     {
-      ret = E_SPI_NOT_INITIALIZE;
-      break;
-    }
+      regs->SPITXBUF = (sendbuff != NULL) ? sendbuff[rxIndex] : SPI_DUMMY_WORD;
 
+      //INT_FLAG is cleared by read of SPIRXBUF
+      while((regs->SPISTS.all & SPI_STS_INT_FLAG) == 0)
+      {
+      }
+
+      word = regs->SPIRXBUF;
+      if(readbuff != NULL)
+      {
+        readbuff[rxIndex] = word;
+      }
+    }
   }
+
   return ret;
 }
-
@@ -12,6 +12,7 @@
 
 //for typedef like a uint8_t
 #include <stdint.h>
+#include "DriverDMA.h"
 
 typedef int err_spi;
 
@@ -21,6 +22,27 @@ typedef int err_spi;
 #define E_SPI_OK                   0     //Operation successful
 #define E_SPI_INVALID_PARAM       -1     //Invalid parameters of config SPI
 #define E_SPI_NOT_INITIALIZE      -2     //SPI is not initialize
+#define E_SPI_BUSY                -3     //Previous transfer is not finished
+#define E_SPI_EMPTY               -4     //No frame is ready at queue of frame pipeline
+
+/**
+ * @brief Frequency of external crystal, used to calculate LSPCLK when OSCCLK is XTAL. Can be defined by project.
+ */
+#ifndef SPI_XTAL_FREQ
+#define SPI_XTAL_FREQ              20000000UL
+#endif
+
+/**
+ * @brief The highest bit rate without high speed mode. Above it HS_MODE is used, which works only at
+ * high speed pins of SPI (GPIO58 - GPIO61 for SPI_A) with asynchronous qualification.
+ */
+#define SPI_NORMAL_FREQ_MAX        25000000UL
+
+/**
+ * @brief Transfer by DMA move one burst of words at each DMA request of FIFO, size of burst is fifo_lvl.
+ * TX FIFO must have place for burst when request is generated, so fifo_lvl must be from 1 to 8.
+ */
+#define SPI_DMA_BURST_MAX          8
 
 
 /**
@@ -209,9 +231,157 @@ typedef struct
 
 }SPI_Cfg;
 
+/**
+ * @brief Config with values of SPI registers precomputed at compile time by SPI_CFG_STATIC
+ */
+typedef struct
+{
+    SPI_Cfg cfg;
+    uint16_t ccr;             //SPICCR, without HS_MODE
+    uint16_t ctl;             //SPICTL
+    uint16_t brr;             //SPIBRR
+    uint16_t fftx;            //SPIFFTX
+    uint16_t ffrx;            //SPIFFRX
+}SPI_CfgImage;
+
+/**
+ * @brief Range check of enum from config, valid values are between MIN and MAX (both not included)
+ */
+#define SPI_IN_RANGE(value, max)      ((uint32_t)(value) < (uint32_t)(max))
+
+/**
+ * @brief Validation of all fields of config, without loops and branches. Value is a constant expression
+ * if all parameters are constant, so can be used at compile time. Bit rate is checked only at master mode
+ * and FIFO level only if FIFO is enabled.
+ *
+ * @return 1 - config is valid, 0 - config is invalid
+ */
+#define SPI_CFG_IS_VALID(spi, mode, polarity, word_size, baud_rate, phase, fifo_set, fifo_lvl)                 \
+  (SPI_IN_RANGE(spi, SPI_MAX) &                                                                                 \
+   SPI_IN_RANGE(mode, MODE_MAX) &                                                                               \
+   SPI_IN_RANGE(polarity, POL_MAX) &                                                                            \
+   SPI_IN_RANGE(word_size, WORD_MAX) &                                                                          \
+   SPI_IN_RANGE(phase, PHA_MAX) &                                                                               \
+   SPI_IN_RANGE(fifo_set, FIFO_MAX) &                                                                           \
+   (((mode) != MODE_MASTER) | (((uint32_t)(baud_rate) >= 3) & ((uint32_t)(baud_rate) <= 127))) &             \
+   (((fifo_set) != FIFO_ON) | SPI_IN_RANGE(fifo_lvl, FIFO_LVLMAX)))
+
+/**
+ * @brief Values of registers, the same as SPI_CONFIG() and SPI_SETUP_FIFO() at DriverSPI.c. Reset bits
+ * (SPISWRESET, TXFIFO, RXFIFORESET) are released.
+ */
+#define SPI_IMAGE_CCR(polarity, word_size)                                                                      \
+  (0x0080U | (uint16_t)(word_size) | (((polarity) == POL_FALLING) ? 0x0040U : 0U))
+#define SPI_IMAGE_CTL(mode, phase)                                                                              \
+  (0x0002U | (((mode) == MODE_MASTER) ? 0x0004U : 0U) | (((phase) == PHA_DELAY) ? 0x0008U : 0U))
+#define SPI_IMAGE_BRR(baud_rate)      ((uint16_t)(baud_rate) & 0x7FU)
+#define SPI_IMAGE_FFTX(fifo_set, fifo_lvl)                                                                      \
+  (((fifo_set) == FIFO_ON) ? (0xE000U | (uint16_t)(fifo_lvl)) : 0xA000U)
+#define SPI_IMAGE_FFRX(fifo_set, fifo_lvl)                                                                      \
+  (((fifo_set) == FIFO_ON) ? (0x2000U | (uint16_t)(fifo_lvl)) : 0U)
+
+/**
+ * @brief Define const config validated at compile time. Invalid config stop compilation with error
+ * about negative size of array 'name_invalid_spi_config'. Config defined by this macro should be
+ * applied by spiCfgStatic(), which do not validate it again. i.e:
+ *
+ *   SPI_CFG_STATIC(adcSpi, SPI_A, MODE_MASTER, POL_RISING, WORD_16b, 9, PHA_NORMAL, FIFO_ON, FIFO_LVL_4);
+ *   SPI_CFG_STATIC(dacSpi, SPI_A, MODE_MASTER, POL_FALLING, WORD_8b, 19, PHA_DELAY, FIFO_ON, FIFO_LVL_4);
+ *   spiCfgStatic(&adcSpi);
+ */
+#define SPI_CFG_STATIC(name, spi, mode, polarity, word_size, baud_rate, phase, fifo_set, fifo_lvl)              \
+  typedef char name##_invalid_spi_config[SPI_CFG_IS_VALID(spi, mode, polarity, word_size, baud_rate, phase,    \
+                                                          fifo_set, fifo_lvl) ? 1 : -1];                        \
+  const SPI_CfgImage name =                                                                                     \
+  {                                                                                                             \
+    { spi, mode, polarity, word_size, baud_rate, phase, fifo_set, fifo_lvl },                                  \
+    SPI_IMAGE_CCR(polarity, word_size), SPI_IMAGE_CTL(mode, phase), SPI_IMAGE_BRR(baud_rate),                  \
+    SPI_IMAGE_FFTX(fifo_set, fifo_lvl), SPI_IMAGE_FFRX(fifo_set, fifo_lvl)                                      \
+  }
+
+/**
+ * @brief Settings of bus which are different for devices at the same SPI, see spiBusSet()
+ */
+typedef struct
+{
+    SPI_PolarityType polarity;
+    SPI_PhaseType phase;
+    SPI_WordType word_size;
+
+    /*
+     * 3 - LSPCLK/4
+     * ...
+     * 127 - LSPCLK/128
+     */
+    uint16_t baud_rate;
+
+}SPI_BusCfg;
+
+/**
+ * @brief Callback called from ISR of DMA when transfer is finished, see spiIRQ_ReadEnable()
+ */
+typedef void (*SPI_Callback)(SPIType spi);
+
+/**
+ * @brief Statistics of FIFO engine, updated by ISR
+ */
+typedef struct
+{
+  uint32_t rxIsr;                 //number of RX FIFO interrupts, one for each batch of fifo_lvl words
+  uint32_t txIsr;                 //number of TX FIFO interrupts
+  uint32_t overflow;              //number of RXFFOVF found by RX ISR, at stream and frames also DMA overflow (OVRFLG)
+  uint32_t blocks;                //number of blocks of stream
+  uint32_t overrun;               //number of blocks of stream overwritten before spiStreamRelease(), frames dropped
+                                  //because queue of frames is full
+  uint32_t frames;                //number of frames published to queue
+} SPI_Stats;
+
+/**
+ * @brief Callback called from ISR of DMA when block of stream is full
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t *block         - full block
+ * @param uint16_t half           - 0 - first half of ring (half-full), 1 - second half (full)
+ */
+typedef void (*SPI_StreamCallback)(SPIType spi, uint16_t *block, uint16_t half);
+
+#define SPI_FRAME_CHANNELS_MAX             16                       //words of one scan, depth of TX FIFO
 
 /**
- * @brief Function used to initialize SPI with specific parameters
+ * @brief Frame of frame pipeline, samples are channel-major: samples[channel * samples_number + sample]
+ */
+typedef struct
+{
+  uint32_t timestamp;             //clock read by ISR at the end of frame
+  uint32_t sequence;              //number of frame since spiFrameStart(), gap means dropped frames
+  uint16_t *samples;
+} SPI_Frame;
+
+/**
+ * @brief Settings of frame pipeline, see spiFrameStart()
+ */
+typedef struct
+{
+  SPIType spi;
+  uint16_t trigger;               //event which starts scan, DMA_TRIGGER_EPWM_SOCA/SOCB(n) or DMA_TRIGGER_TINT(n),
+                                  //event must be enabled at peripheral, i.e. ETSEL.SOCAEN of ePWM or TIE of timer
+  const uint16_t *commands;       //words sent at each scan, one for each channel, GS RAM
+  uint16_t channels;              //words of one scan, multiple of fifo_lvl, up to SPI_FRAME_CHANNELS_MAX
+  uint16_t samples;               //scans of one frame
+  uint16_t *pool;                 //samples of frames, depth * channels * samples words at GS RAM
+  SPI_Frame *frames;              //queue of depth frames
+  uint16_t depth;                 //power of 2, at least 2, application can hold depth - 1 frames
+  volatile uint32_t *clock;       //free running counter of timestamp, i.e. &CpuTimer2Regs.TIM.all, NULL - not used
+  SPI_Callback callback;          //called from ISR when frame is published, NULL if not used
+} SPI_FrameCfg;
+
+/**
+ * @brief Function used to initialize SPI with specific parameters. Driver keeps shadow of the last config,
+ * so next call writes only fields which are changed. SPI is reset only when polarity, phase or mode is
+ * changed and FIFO is reset only when FIFO settings are changed or when transfer of spiTransferFIFO() is
+ * dropped. Transfer in progress is dropped, so it should be called when spiBusy() return 0. Two DMA channels of SPI are allocated by dmaAlloc(), which
+ * gives DMA_CH1 as the last one, see spiDmaChannels(). If there are no free channels DMA transfers of SPI
+ * return E_SPI_NOT_INITIALIZE.
  *
  * @param SPI_Cfg *config - pointer to initialize struct
  *
@@ -220,36 +390,288 @@ typedef struct
 err_spi spiCfg(SPI_Cfg *config);
 
 /**
- * @brief Function used to send data thru SPI. Function send word of size initial by 'spiCfg()' function.
+ * @brief Function used to config SPI by const config validated at compile time by SPI_CFG_STATIC. Config
+ * is not validated at runtime. If SPI is already configured with the same FIFO settings only precomputed
+ * SPICCR, SPICTL and SPIBRR which differ from shadow are stored, otherwise it works as spiCfg().
+ *
+ * @param const SPI_CfgImage *image - config defined by SPI_CFG_STATIC
+ *
+ * @return Status of operation
+ */
+err_spi spiCfgStatic(const SPI_CfgImage *image);
+
+/**
+ * @brief Function used to send data thru SPI by DMA. Function send word of size initial by 'spiCfg()' function.
  * i.e If you try send data with different word size function send only first 'size' bits of your data
- * i.e without report any error.
- * i.e Driver do not copy sendbuff, so application MUST hold buff until data is send.
+ * i.e without report any error. Word shorter than 16 bits must be left-justified.
+ * i.e Driver do not copy sendbuff, so application MUST hold buff until data is send (spiBusy() return 0
+ * or callback is called). Buff must be at GS RAM, because DMA can not access other memory.
+ * Received words are dropped.
  *
  * @param SPIType spi             - numerate representation of used SPI
  * @param uint16 *sendbuff        - pointer to buff with data to send
- * @param uint16_t length         - number of data to send
+ * @param uint16_t length         - number of data to send, must be multiple of fifo_lvl
  *
  * @return Status of operation
  */
 err_spi spiSend(SPIType spi, uint16_t *sendbuff, uint16_t length);
 
 /**
- * @brief Function read data from specific SPI
+ * @brief Function read data from specific SPI by DMA. Words 0xFFFF are sent during read.
+ * i.e Driver write directly to readbuff, so application MUST NOT use buff until data is read (spiBusy()
+ * return 0 or callback is called). Buff must be at GS RAM.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t *readbuff      - pointer to buff for received data, right-justified
+ * @param uint16_t length         - number of data to read, must be multiple of fifo_lvl
+ *
+ * @return Status of operation
+ */
+err_spi spiRead(SPIType spi, uint16_t *readbuff, uint16_t length);
+
+/**
+ * @brief Function used to send and read data at the same time by DMA (full duplex). Rules of spiSend()
+ * and spiRead() for buffs are valid. sendbuff and readbuff can be the same buff.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t *sendbuff      - pointer to buff with data to send
+ * @param uint16_t *readbuff      - pointer to buff for received data
+ * @param uint16_t length         - number of words, must be multiple of fifo_lvl
+ *
+ * @return Status of operation
+ */
+err_spi spiTransfer(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length);
+
+/**
+ * @brief Function used to check if transfer is finished. Can be used as poll flag when interrupt is disabled.
  *
  * @param SPIType spi  - numerate representation of used SPI
  *
+ * @return 1 - transfer is in progress and buffs are owned by driver, 0 - buffs are returned to application
+ *         or spi is out of range
+ */
+uint16_t spiBusy(SPIType spi);
+
+/**
+ * @brief Function used to drop transfer of spiSend(), spiRead(), spiTransfer() or spiTransferFIFO(), i.e. after
+ * timeout. DMA channels are stopped, FIFO interrupts are disabled and FIFOs are reset, callback is not called.
+ * Buffs are returned to application at once. Stream and frame pipeline are stopped by spiStreamStop() and
+ * spiFrameStop().
+ *
+ * @param SPIType spi  - numerate representation of used SPI
+ *
+ * @return Status of operation
+ */
+err_spi spiAbort(SPIType spi);
+
+/**
+ * @brief Function used to register callback called when transfer is finished
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param SPI_Callback callback   - function called from ISR, NULL if not used
+ *
  * @return Status of operation
  */
-err_spi spiRead(SPIType spi);
+err_spi spiCallback(SPIType spi, SPI_Callback callback);
 
 /**
- * @brief Function enable interrupt from FIFO TX
+ * @brief Function enable interrupt from DMA at the end of read, so end of transfer is reported by callback
+ * and spiBusy() do not access DMA. Used by next transfers.
  */
-void spiIRQ_ReadEnable();
+void spiIRQ_ReadEnable(void);
 
 /**
- * @brief Function disable interrupt from FIFO RX
+ * @brief Function disable interrupt from DMA at the end of read, end of transfer should be polled by spiBusy()
+ */
+void spiIRQ_ReadDisable(void);
+
+/**
+ * @brief Function used to send and read data by FIFO interrupts, for SPI without free DMA channels.
+ * When words are read, RX FIFO is read by RX ISR when it has fifo_lvl words and TX FIFO is refilled by the
+ * same ISR. When words are only sent, TX FIFO is refilled by TX ISR when it has fifo_lvl words or less
+ * and the last word is waited by RX ISR. So there is one interrupt for each batch of words. FIFO must be enabled with fifo_lvl bigger than 0.
+ * End of transfer is reported by spiBusy() and callback like at DMA transfer. Buffs can be at any RAM.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t *sendbuff      - pointer to buff with data to send, NULL - words 0xFFFF are sent
+ * @param uint16_t *readbuff      - pointer to buff for received data, NULL - received words are dropped
+ *                                  and sendbuff can not be NULL
+ * @param uint16_t length         - number of words
+ *
+ * @return Status of operation
+ */
+err_spi spiTransferFIFO(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length);
+
+/**
+ * @brief Function used to read statistics of FIFO engine
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param SPI_Stats *stats        - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_spi spiStats(SPIType spi, SPI_Stats *stats);
+
+/**
+ * @brief Function used to read DMA channels allocated for SPI by spiCfg(), i.e. to read their statistics
+ * from DMA driver
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param DMA_ChannelType *tx     - pointer where channel which writes SPITXBUF is written
+ * @param DMA_ChannelType *rx     - pointer where channel which reads SPIRXBUF is written
+ *
+ * @return Status of operation, E_SPI_NOT_INITIALIZE if SPI has no DMA channels
+ */
+err_spi spiDmaChannels(SPIType spi, DMA_ChannelType *tx, DMA_ChannelType *rx);
+
+/**
+ * @brief Function used to change settings of bus of master SPI configured by spiCfg(). Only registers which
+ * differ from current settings are written, SPI is reset only when polarity or phase of clock is changed.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param const SPI_BusCfg *bus   - settings of bus
+ *
+ * @return Status of operation, E_SPI_NOT_INITIALIZE if SPI is not configured, E_SPI_BUSY if transfer is in
+ *         progress
+ */
+err_spi spiBusSet(SPIType spi, const SPI_BusCfg *bus);
+
+/**
+ * @brief Function used to calculate LSPCLK from registers of clock tree (OSCCLK source, SYSPLL, PLLSYSCLK
+ * divider and LSPCLK divider)
+ *
+ * @return Frequency of LSPCLK in Hz
+ */
+uint32_t spiLSPCLK(void);
+
+/**
+ * @brief Function used to calculate SPIBRR divider for frequency. Bit rate is never bigger than frequency.
+ * Can be used to fill baud_rate of SPI_Cfg and SPI_BusCfg.
+ *
+ * @param uint32_t frequency      - target bit rate in Hz
+ * @param uint16_t *divider       - pointer where divider (SPIBRR) is written
+ * @param uint32_t *achieved      - pointer where real bit rate in Hz is written, NULL if not used
+ *
+ * @return Status of operation, E_SPI_INVALID_PARAM if frequency is lower than LSPCLK/128 or bigger than LSPCLK/4
+ */
+err_spi spiBaudDivider(uint32_t frequency, uint16_t *divider, uint32_t *achieved);
+
+/**
+ * @brief Function used to set bit rate of master SPI configured by spiCfg(). Divider is calculated by
+ * spiBaudDivider() and high speed mode is enabled when bit rate is bigger than SPI_NORMAL_FREQ_MAX.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint32_t frequency      - target bit rate in Hz
+ * @param uint32_t *achieved      - pointer where real bit rate in Hz is written, NULL if not used
+ *
+ * @return Status of operation, E_SPI_NOT_INITIALIZE if SPI is not configured as master, E_SPI_INVALID_PARAM
+ *         if frequency is out of range of spiBaudDivider()
+ */
+err_spi spiBaudSet(SPIType spi, uint32_t frequency, uint32_t *achieved);
+
+/**
+ * @brief Function used to start continuous receive of slave SPI to ring of two blocks (ping-pong). Every
+ * block is one DMA transfer of fifo_lvl word bursts, there is one interrupt for each block and no CPU work
+ * for each word. Callback is called when block is full, application owns block until spiStreamRelease().
+ * DMA continues to the other block meanwhile. SPI must be configured by spiCfg() as MODE_SLAVE with FIFO
+ * level 1 - SPI_DMA_BURST_MAX.
+ *
+ * @param SPIType spi                     - numerate representation of used SPI
+ * @param uint16_t *ring                  - buff of 2 * block words at GS RAM
+ * @param uint16_t block                  - number of words at block, must be multiple of fifo_lvl
+ * @param SPI_StreamCallback callback     - function called from ISR when block is full
+ *
+ * @return Status of operation
+ */
+err_spi spiStreamStart(SPIType spi, uint16_t *ring, uint16_t block, SPI_StreamCallback callback);
+
+/**
+ * @brief Function used to return block of stream to DMA. Block not released before DMA writes it again
+ * is counted as overrun at spiStats().
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t half           - block from callback
+ *
+ * @return Status of operation
+ */
+err_spi spiStreamRelease(SPIType spi, uint16_t half);
+
+/**
+ * @brief Function used to stop stream, block being filled is dropped
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ *
+ * @return Status of operation
+ */
+err_spi spiStreamStop(SPIType spi);
+
+/**
+ * @brief Function used to start frame pipeline of external ADC at master SPI. At each trigger event DMA
+ * sends commands to TX FIFO and the other DMA channel moves received words to frame. Addresses of DMA
+ * (steps and wrap) put scans to channel-major order, so CPU is not used until frame of samples scans is full.
+ * Then ISR takes timestamp and publishes frame to lock-free single-producer/single-consumer queue read by
+ * spiFrameGet() and spiFrameRelease(). If queue is full, frame is dropped and counted as overrun at
+ * spiStats(). SPI must be configured by spiCfg() as MODE_MASTER with FIFO level 1 - SPI_DMA_BURST_MAX.
+ *
+ * @param const SPI_FrameCfg *config      - settings of pipeline, buffs must be kept until spiFrameStop()
+ *
+ * @return Status of operation
+ */
+err_spi spiFrameStart(const SPI_FrameCfg *config);
+
+/**
+ * @brief Function used to get the oldest frame of queue. Frame is owned by application until
+ * spiFrameRelease(). Must be called only by one consumer.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param SPI_Frame **frame       - pointer where address of frame is written
+ *
+ * @return Status of operation, E_SPI_EMPTY if no frame is ready
+ */
+err_spi spiFrameGet(SPIType spi, SPI_Frame **frame);
+
+/**
+ * @brief Function used to return frame got by spiFrameGet() to queue
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ *
+ * @return Status of operation, E_SPI_EMPTY if queue has no frame
+ */
+err_spi spiFrameRelease(SPIType spi);
+
+/**
+ * @brief Function used to stop frame pipeline, frame being filled is dropped. Frames of queue are kept
+ * until the next spiFrameStart().
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ *
+ * @return Status of operation
+ */
+err_spi spiFrameStop(SPIType spi);
+
+/**
+ * @brief Function used to enable internal loopback (SPILBK), SPISIMO is connected to SPISOMI inside SPI.
+ * Works only at master mode, used by self-test. Setting is kept by spiCfg().
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t enable         - 1 - loopback enabled, 0 - normal mode
+ *
+ * @return Status of operation
+ */
+err_spi spiLoopback(SPIType spi, uint16_t enable);
+
+/**
+ * @brief Function used to transfer words by CPU, without DMA and interrupts. Function returns when the
+ * last word is received. With FIFO enabled up to 16 words are in flight, without FIFO every word is
+ * waited by INT_FLAG. At slave mode function waits for master.
+ *
+ * @param SPIType spi             - numerate representation of used SPI
+ * @param uint16_t *sendbuff      - words to send, NULL - words 0xFFFF are sent
+ * @param uint16_t *readbuff      - received words, NULL - received words are dropped
+ * @param uint16_t length         - number of words
+ *
+ * @return Status of operation
  */
-void spiIRQ_ReadDisable();
+err_spi spiTransferPolled(SPIType spi, uint16_t *sendbuff, uint16_t *readbuff, uint16_t length);
 
 #endif /* DRIVERSPI_H_ */
@@ -0,0 +1,191 @@
+/**
+ * @file DriverSPIBench.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of SPI loopback self-test and throughput benchmark working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverSPIBench.h"
+
+#ifdef HOST_SIM
+#include "HostModel.h"
+#define SPI_BENCH_IDLE()             HostModel_Service()     //interrupts are dispatched by model
+#else
+#define SPI_BENCH_IDLE()
+#endif
+
+#define SPI_BENCH_TCR_TSS            0x0010
+#define SPI_BENCH_TCR_TRB            0x0020
+#define SPI_BENCH_PERIOD             0xFFFFFFFFUL
+
+//DMA can access only GS RAM
+#pragma DATA_SECTION(spiBenchSend, "ramgs_dma")
+static uint16_t spiBenchSend[SPI_BENCH_LENGTH_MAX];
+#pragma DATA_SECTION(spiBenchRead, "ramgs_dma")
+static uint16_t spiBenchRead[SPI_BENCH_LENGTH_MAX];
+
+//******************************************************STATIC FUNCTION**************************************************
+
+/**
+ * @brief Static function used to start CPU timer 1, it counts SYSCLK cycles down from 0xFFFFFFFF
+ */
+static void SPI_BENCH_TIMER(void)
+{
+  EALLOW;
+  CpuSysRegs.PCLKCR0.bit.CPUTIMER1 = 1;
+  EDIS;
+
+  CpuTimer1Regs.TCR.all = SPI_BENCH_TCR_TSS;
+  CpuTimer1Regs.PRD.all = SPI_BENCH_PERIOD;
+  CpuTimer1Regs.TPR.all = 0;
+  CpuTimer1Regs.TPRH.all = 0;
+  CpuTimer1Regs.TCR.all = SPI_BENCH_TCR_TSS | SPI_BENCH_TCR_TRB;
+  CpuTimer1Regs.TCR.all = 0;
+}
+
+/**
+ * @brief Static function used to make one transfer and wait for its end
+ */
+static err_spi SPI_BENCH_TRANSFER(const SPI_BenchCfg *config, SPI_BenchModeType mode, uint32_t start)
+{
+  err_spi ret = E_SPI_OK;
+
+  switch(mode)
+  {
+    case SPI_BENCH_POLLED:
+      ret = spiTransferPolled(config->spi, spiBenchSend, spiBenchRead, config->length);
+      break;
+    case SPI_BENCH_FIFO:
+      ret = spiTransferFIFO(config->spi, spiBenchSend, spiBenchRead, config->length);
+      break;
+    default:
+      ret = spiTransfer(config->spi, spiBenchSend, spiBenchRead, config->length);
+      break;
+  }
+
+  while((ret == E_SPI_OK) && spiBusy(config->spi))
+  {
+    SPI_BENCH_IDLE();
+
+    //transfer is dropped, so ISR does not write spiBenchRead during the next transfer
+    if(start - CpuTimer1Regs.TIM.all > SPI_BENCH_TIMEOUT)
+    {
+      spiAbort(config->spi);
+      ret = E_SPI_BUSY;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Static function used to run all transfers of one mode and word size
+ */
+static void SPI_BENCH_STEP(const SPI_BenchCfg *config, SPI_BenchModeType mode, SPI_WordType word, SPI_BenchResult *result)
+{
+  SPI_Cfg cfg = { config->spi, MODE_MASTER, POL_RISING, word, config->baud_rate, PHA_NORMAL, FIFO_ON, config->fifo_lvl };
+  uint16_t bits = (uint16_t)word + 1;
+  uint16_t mask = (uint16_t)((1UL << bits) - 1);
+  uint32_t start = 0;
+  uint32_t latency = 0;
+  uint16_t t = 0;
+  uint16_t i = 0;
+  err_spi ret = E_SPI_OK;
+
+  result->status = E_SPI_OK;
+  result->words = 0;
+  result->errors = 0;
+  result->cycles = 0;
+  result->latencyMin = SPI_BENCH_PERIOD;
+  result->latencyMax = 0;
+  result->bitsPerKCycle = 0;
+
+  //CPU waits for INT_FLAG of every word without FIFO
+  if(mode == SPI_BENCH_POLLED)
+  {
+    cfg.fifo_set = FIFO_OFF;
+  }
+
+  ret = spiCfg(&cfg);
+  if(ret == E_SPI_OK)
+  {
+    ret = spiLoopback(config->spi, 1);
+  }
+
+  for(t = 0; (t < config->transfers) && (ret == E_SPI_OK); t++)
+  {
+    //word is sent from MSB, so data is left-justified, received word is right-justified
+    for(i = 0; i < config->length; i++)
+    {
+      spiBenchSend[i] = (uint16_t)(0xA5C3 ^ ((t + 1) * 0x3B5DU) ^ (i * 0x9E37U));
+      spiBenchRead[i] = 0;
+    }
+
+    start = CpuTimer1Regs.TIM.all;
+    ret = SPI_BENCH_TRANSFER(config, mode, start);
+    latency = start - CpuTimer1Regs.TIM.all;
+
+    if(ret != E_SPI_OK)
+    {
+      break;
+    }
+
+    result->words += config->length;
+    result->cycles += latency;
+    result->latencyMin = (latency < result->latencyMin) ? latency : result->latencyMin;
+    result->latencyMax = (latency > result->latencyMax) ? latency : result->latencyMax;
+
+    for(i = 0; i < config->length; i++)
+    {
+      if((spiBenchRead[i] & mask) != (uint16_t)(spiBenchSend[i] >> (16 - bits)))
+      {
+        result->errors++;
+      }
+    }
+  }
+
+  if(ret != E_SPI_OK)
+  {
+    result->status = ret;
+  }
+
+  if(result->cycles != 0)
+  {
+    result->bitsPerKCycle = (uint32_t)(((uint64_t)result->words * bits * 1000) / result->cycles);
+  }
+  if(result->words == 0)
+  {
+    result->latencyMin = 0;
+  }
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_spi spiBenchRun(const SPI_BenchCfg *config, SPI_BenchReport *report)
+{
+  uint16_t mode = 0;
+  uint16_t word = 0;
+
+  if((config == NULL) || (report == NULL) || ((uint32_t)config->spi >= SPI_MAX) || (config->transfers == 0) ||
+     (config->fifo_lvl < FIFO_LVL_1) || (config->fifo_lvl > SPI_DMA_BURST_MAX) ||
+     (config->length == 0) || (config->length > SPI_BENCH_LENGTH_MAX) || (config->length % config->fifo_lvl != 0))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  SPI_BENCH_TIMER();
+
+  for(mode = 0; mode < SPI_BENCH_MAX; mode++)
+  {
+    for(word = 0; word < SPI_BENCH_WORDS; word++)
+    {
+      SPI_BENCH_STEP(config, (SPI_BenchModeType)mode, (SPI_WordType)word, &report->result[mode][word]);
+    }
+  }
+
+  spiLoopback(config->spi, 0);
+
+  return E_SPI_OK;
+}
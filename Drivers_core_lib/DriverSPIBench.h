@@ -0,0 +1,90 @@
+/**
+ * @file DriverSPIBench.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of SPI loopback self-test and throughput benchmark. SPI works as master with internal
+ * loopback (SPILBK), so no wire and no device is needed. For every mode of transfer (polled, FIFO interrupt,
+ * DMA) and every word size WORD_1b - WORD_16b the same transfers are made, received words are compared with
+ * sent ones and time is measured by CPU timer 1 in SYSCLK cycles. Report has only 32-bit fields, so it can be
+ * sent over SCI as it is, i.e:
+ *
+ *   EINT;                                         //FIFO engine works by interrupts
+ *   spiBenchRun(&benchCfg, &benchReport);
+ *   sciSend((uint16_t *)&benchReport, sizeof(benchReport));
+ *
+ * Config of SPI is overwritten and CPU timer 1 is used. SPI must not be used by queue (DriverSPIQueue.h)
+ * during benchmark. At host simulation registers of SPI, DMA and timer are simulated by HostModel.h.
+ */
+
+#ifndef DRIVERSPIBENCH_H_
+#define DRIVERSPIBENCH_H_
+
+#include <stdint.h>
+#include "DriverSPI.h"
+
+#define SPI_BENCH_LENGTH_MAX       64                //words of one transfer
+#define SPI_BENCH_WORDS            16                //word sizes WORD_1b - WORD_16b
+#define SPI_BENCH_TIMEOUT          1000000UL         //SYSCLK cycles, transfer not finished in this time is failed
+
+/**
+ * @brief Mode of transfer
+ */
+typedef enum
+{
+  SPI_BENCH_MIN = -1,        //Not related to benchmark, for debug purpose
+
+  SPI_BENCH_POLLED,          //spiTransferPolled(), FIFO disabled, CPU waits for every word
+  SPI_BENCH_FIFO,            //spiTransferFIFO(), interrupts of FIFO
+  SPI_BENCH_DMA,             //spiTransfer(), DMA
+  SPI_BENCH_MAX              //Not related to benchmark, for debug purpose
+
+} SPI_BenchModeType;
+
+/**
+ * @brief Settings of benchmark
+ */
+typedef struct
+{
+  SPIType spi;
+  uint16_t baud_rate;        //SPIBRR, 3 - 127
+  SPI_FIFOLVLType fifo_lvl;  //FIFO_LVL_1 - FIFO_LVL_8, watermark of FIFO engine and burst of DMA
+  uint16_t length;           //words of one transfer, multiple of fifo_lvl, up to SPI_BENCH_LENGTH_MAX
+  uint16_t transfers;        //transfers made for each mode and word size
+} SPI_BenchCfg;
+
+/**
+ * @brief Result of one mode and word size
+ */
+typedef struct
+{
+  int32_t status;            //status of the first failed call, E_SPI_OK if all transfers are finished
+  uint32_t words;            //words transferred
+  uint32_t errors;           //received words different from sent ones
+  uint32_t cycles;           //SYSCLK cycles of all transfers
+  uint32_t latencyMin;       //SYSCLK cycles of one transfer, from call to end of transfer
+  uint32_t latencyMax;
+  uint32_t bitsPerKCycle;    //sustained throughput, bits per 1000 SYSCLK cycles
+} SPI_BenchResult;
+
+/**
+ * @brief Report of benchmark, result[mode][word size]
+ */
+typedef struct
+{
+  SPI_BenchResult result[SPI_BENCH_MAX][SPI_BENCH_WORDS];
+} SPI_BenchReport;
+
+/**
+ * @brief Function used to run self-test and benchmark of all modes and word sizes. Loopback is disabled at
+ * the end, SPI stays configured by the last step.
+ *
+ * @param const SPI_BenchCfg *config   - settings of benchmark
+ * @param SPI_BenchReport *report      - results
+ *
+ * @return Status of operation, E_SPI_OK also if some transfers are failed, see status and errors of results
+ */
+err_spi spiBenchRun(const SPI_BenchCfg *config, SPI_BenchReport *report);
+
+#endif /* DRIVERSPIBENCH_H_ */
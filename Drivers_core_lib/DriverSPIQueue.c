@@ -0,0 +1,236 @@
+/**
+ * @file DriverSPIQueue.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of SPI transaction queue working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverSPIQueue.h"
+
+#define SPI_QUEUE_NUMBER      3
+#define SPI_QUEUE_INT         (M_INT6 | M_INT7)      //FIFO and DMA interrupts of SPI
+
+/**
+ * @brief Lane of transactions, linked by 'next'
+ */
+typedef struct
+{
+  SPI_Transaction *head;
+  SPI_Transaction *tail;
+} SPI_Lane;
+
+/**
+ * @brief Queue of one SPI. Lanes and active transaction are changed with FIFO and DMA interrupts disabled
+ * or from their ISR.
+ */
+typedef struct
+{
+  SPI_Lane lane[SPI_PRIO_MAX];
+  SPI_Transaction *active;            //transaction at bus, NULL if bus is free
+} SPI_Queue;
+
+static SPI_Queue spiQueues[SPI_QUEUE_NUMBER];
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static SPI_Transaction* SPI_QUEUE_POP(SPI_Queue *queue)
+{
+  SPI_Lane *lane = &queue->lane[SPI_PRIO_HIGH];
+  SPI_Transaction *transaction = NULL;
+
+  if(lane->head == NULL)
+  {
+    lane = &queue->lane[SPI_PRIO_NORMAL];
+  }
+
+  transaction = lane->head;
+  if(transaction != NULL)
+  {
+    lane->head = transaction->next;
+  }
+
+  return transaction;
+}
+
+/**
+ * @brief Static function used to start transaction by DMA. If DMA can not be used (FIFO level is bigger
+ * than DMA burst or length is not multiple of burst) FIFO engine is used.
+ */
+static err_spi SPI_QUEUE_START(SPIType spi, SPI_Transaction *transaction)
+{
+  err_spi ret = E_SPI_OK;
+
+  if(transaction->readbuff == NULL)
+  {
+    ret = spiSend(spi, transaction->sendbuff, transaction->length);
+  }
+  else if(transaction->sendbuff == NULL)
+  {
+    ret = spiRead(spi, transaction->readbuff, transaction->length);
+  }
+  else
+  {
+    ret = spiTransfer(spi, transaction->sendbuff, transaction->readbuff, transaction->length);
+  }
+
+  if((ret == E_SPI_NOT_INITIALIZE) || (ret == E_SPI_INVALID_PARAM))
+  {
+    ret = spiTransferFIFO(spi, transaction->sendbuff, transaction->readbuff, transaction->length);
+  }
+
+  return ret;
+}
+
+static void SPI_QUEUE_FINISH(SPI_Transaction *transaction, err_spi status)
+{
+  pinGPIOHandleSet(&transaction->device->cs);
+
+  transaction->status = status;
+  if(transaction->done != NULL)
+  {
+    transaction->done(transaction);
+  }
+}
+
+/**
+ * @brief Static function used to start next transaction. Transactions which can not be started are
+ * finished with error.
+ */
+static void SPI_QUEUE_NEXT(SPIType spi)
+{
+  SPI_Queue *queue = &spiQueues[spi];
+  SPI_Transaction *transaction = NULL;
+  err_spi ret = E_SPI_OK;
+
+  for(;;)
+  {
+    transaction = SPI_QUEUE_POP(queue);
+    queue->active = transaction;
+
+    if(transaction == NULL)
+    {
+      break;
+    }
+
+    //SPI registers are written only if device is changed
+    ret = spiBusSet(spi, &transaction->device->bus);
+    if(ret == E_SPI_OK)
+    {
+      pinGPIOHandleClear(&transaction->device->cs);
+      ret = SPI_QUEUE_START(spi, transaction);
+    }
+
+    if(ret == E_SPI_OK)
+    {
+      break;
+    }
+
+    SPI_QUEUE_FINISH(transaction, ret);
+  }
+}
+
+/**
+ * @brief Callback of SPI, called from ISR of DMA or FIFO at the end of transfer
+ */
+static void SPI_QUEUE_DONE(SPIType spi)
+{
+  SPI_Transaction *transaction = spiQueues[spi].active;
+
+  //queue is still busy at callback of transaction, so post from callback only add transaction to lane
+  if(transaction != NULL)
+  {
+    SPI_QUEUE_FINISH(transaction, E_SPI_OK);
+  }
+
+  SPI_QUEUE_NEXT(spi);
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_spi spiQueueInit(SPIType spi)
+{
+  err_spi ret = E_SPI_OK;
+  SPI_Queue *queue = NULL;
+
+  if((uint32_t)spi >= SPI_QUEUE_NUMBER)
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    queue = &spiQueues[spi];
+    queue->lane[SPI_PRIO_NORMAL].head = NULL;
+    queue->lane[SPI_PRIO_HIGH].head = NULL;
+    queue->active = NULL;
+
+    spiCallback(spi, SPI_QUEUE_DONE);
+    spiIRQ_ReadEnable();
+  }
+
+  return ret;
+}
+
+err_spi spiQueueDeviceInit(SPI_Device *device)
+{
+  err_spi ret = E_SPI_OK;
+
+  if((device == NULL) || (pinGPIOHandle(device->csPin, &device->cs) != E_GPIO_OK))
+  {
+    ret = E_SPI_INVALID_PARAM;
+  }
+  else
+  {
+    pinGPIOHandleSet(&device->cs);
+  }
+
+  return ret;
+}
+
+err_spi spiQueuePost(SPIType spi, SPI_Transaction *transaction, SPI_PriorityType priority)
+{
+  SPI_Queue *queue = NULL;
+  SPI_Lane *lane = NULL;
+  uint16_t ier = 0;
+
+  if(((uint32_t)spi >= SPI_QUEUE_NUMBER) || (transaction == NULL) || (transaction->device == NULL) ||
+     ((uint32_t)priority >= SPI_PRIO_MAX))
+  {
+    return E_SPI_INVALID_PARAM;
+  }
+
+  queue = &spiQueues[spi];
+  lane = &queue->lane[priority];
+
+  transaction->status = E_SPI_BUSY;
+  transaction->next = NULL;
+
+  //interrupts of SPI are masked at IER, so it works also from ISR of other group and does not change INTM
+  ier = IER & SPI_QUEUE_INT;
+  IER &= ~SPI_QUEUE_INT;
+
+  if(lane->head == NULL)
+  {
+    lane->head = transaction;
+  }
+  else
+  {
+    lane->tail->next = transaction;
+  }
+  lane->tail = transaction;
+
+  if(queue->active == NULL)
+  {
+    SPI_QUEUE_NEXT(spi);
+  }
+
+  IER |= ier;
+
+  return E_SPI_OK;
+}
+
+uint16_t spiQueueBusy(SPIType spi)
+{
+  return (((uint32_t)spi < SPI_QUEUE_NUMBER) && (spiQueues[spi].active != NULL)) ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file DriverSPIQueue.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of SPI transaction queue. Devices at the same SPI are served one by one from queue,
+ * next transaction is started from ISR of previous one (DMA or FIFO), so there is no gap made by application.
+ * Chip select of device is driven by driver and settings of bus are written only when device is changed.
+ * Transactions of high priority lane (i.e read of sensors of control loop) are taken before normal lane.
+ *
+ *   spiCfg(&spiConfig);                                       //master, FIFO on
+ *   spiQueueInit(SPI_A);
+ *   spiQueueDeviceInit(&adcDevice);                            //cs pin configured as output before
+ *
+ *   adcRead.device = &adcDevice;
+ *   adcRead.sendbuff = adcCmd;
+ *   adcRead.readbuff = adcData;
+ *   adcRead.length = 4;
+ *   spiQueuePost(SPI_A, &adcRead, SPI_PRIO_HIGH);
+ */
+
+#ifndef DRIVERSPIQUEUE_H_
+#define DRIVERSPIQUEUE_H_
+
+#include <stdint.h>
+#include "DriverGPIO.h"
+#include "DriverSPI.h"
+
+/**
+ * @brief Lane of queue
+ */
+typedef enum
+{
+  SPI_PRIO_MIN = -1,        //Not related to queue, for debug purpose
+
+  SPI_PRIO_NORMAL,          //served when high lane is empty
+  SPI_PRIO_HIGH,            //served as first
+  SPI_PRIO_MAX              //Not related to queue, for debug purpose
+
+} SPI_PriorityType;
+
+/**
+ * @brief Device at SPI bus
+ */
+typedef struct
+{
+  SPI_BusCfg bus;           //settings of bus used by device
+  uint32_t csPin;           //chip select, active low, configured as output by application
+  GPIOPin_Type cs;          //handle of chip select, initialized by spiQueueDeviceInit()
+} SPI_Device;
+
+struct SPI_Transaction;
+
+/**
+ * @brief Callback called from ISR when transaction is finished, chip select is already released
+ */
+typedef void (*SPI_TransactionCallback)(struct SPI_Transaction *transaction);
+
+/**
+ * @brief One transaction. Struct and buffs are owned by queue from spiQueuePost() until status is not
+ * E_SPI_BUSY. Buffs of transaction sent by DMA must be at GS RAM.
+ */
+typedef struct SPI_Transaction
+{
+  const SPI_Device *device;
+  uint16_t *sendbuff;                 //NULL - words 0xFFFF are sent
+  uint16_t *readbuff;                 //NULL - received words are dropped
+  uint16_t length;
+  SPI_TransactionCallback done;       //NULL if not used
+  volatile err_spi status;            //E_SPI_BUSY until transaction is finished
+  struct SPI_Transaction *next;       //used by queue
+} SPI_Transaction;
+
+/**
+ * @brief Function used to start queue of SPI configured by spiCfg() with FIFO enabled. Callback of SPI and
+ * interrupt of DMA (spiIRQ_ReadEnable()) are used by queue.
+ *
+ * @param SPIType spi - numerate representation of used SPI
+ *
+ * @return Status of operation
+ */
+err_spi
+spiQueueInit(SPIType spi);
+
+/**
+ * @brief Function used to resolve chip select of device and release it
+ *
+ * @param SPI_Device *device - device with csPin and bus filled
+ *
+ * @return Status of operation
+ */
+err_spi
+spiQueueDeviceInit(SPI_Device *device);
+
+/**
+ * @brief Function used to add transaction at the end of lane. Transaction is started at once if SPI is
+ * free. Can be called from ISR, also from callback of transaction.
+ *
+ * @param SPIType spi - numerate representation of used SPI
+ * @param SPI_Transaction *transaction - transaction, can not be already queued
+ * @param SPI_PriorityType priority - lane of queue
+ *
+ * @return Status of operation
+ */
+err_spi
+spiQueuePost(SPIType spi, SPI_Transaction *transaction, SPI_PriorityType priority);
+
+/**
+ * @brief Function used to check if queue is empty
+ *
+ * @param SPIType spi - numerate representation of used SPI
+ *
+ * @return 1 - transaction is in progress or queued, 0 - queue is empty
+ */
+uint16_t
+spiQueueBusy(SPIType spi);
+
+#endif /* DRIVERSPIQUEUE_H_ */
@@ -0,0 +1,196 @@
+/**
+ * @file DriverXINT.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of GPIO external interrupt driver working at tms320F28377S
+ */
+#include "F2837xS_device.h"
+#include "DriverGPIO.h"
+#include "DriverXINT.h"
+
+#define XINT_NUMBER           5
+#define XINT_COUNTER_NUMBER   3         //only XINT1 - XINT3 have counter
+#define XINT_ENABLE           0x0001    //XINTxCR.ENABLE
+#define XINT_POLARITY_SHIFT   2         //XINTxCR.POLARITY
+
+/**
+ * @brief Hardware resources of one XINT
+ */
+typedef struct
+{
+  uint16_t xbarInput;         //offset of INPUTxSELECT from INPUT1SELECT
+  uint16_t pieGroup;          //offset of PIEIERx from PIEIER1, in 16-bit registers
+  uint16_t pieMask;           //bit of interrupt at PIEIERx
+  uint16_t ack;               //PIEACK and IER bit of PIE group
+} XINT_Resource;
+
+/**
+ * @brief State of one XINT. Callback is NULL if XINT is not configured.
+ */
+typedef struct
+{
+  XINT_Callback callback;
+  XINT_Stats stats;
+} XINT_State;
+
+static const XINT_Resource XINT_RESOURCES[XINT_NUMBER] =
+{
+  { 3,  0,  0x0008, M_INT1 },         //XINT1 - INPUT4, INT1.4
+  { 4,  0,  0x0010, M_INT1 },         //XINT2 - INPUT5, INT1.5
+  { 5,  22, 0x0001, M_INT12 },        //XINT3 - INPUT6, INT12.1
+  { 12, 22, 0x0002, M_INT12 },        //XINT4 - INPUT13, INT12.2
+  { 13, 22, 0x0004, M_INT12 },        //XINT5 - INPUT14, INT12.3
+};
+
+static XINT_State xintState[XINT_NUMBER];
+
+//******************************************************STATIC FUNCTION**************************************************
+
+/**
+ * @brief Static function shared by ISR of all XINT. Counter is already read by ISR.
+ */
+static inline void XINT_DISPATCH(XINTType xint, uint16_t latency)
+{
+  XINT_State *state = &xintState[xint];
+
+  state->stats.count++;
+  state->stats.latency = latency;
+  if(latency > state->stats.latencyMax)
+  {
+    state->stats.latencyMax = latency;
+  }
+
+  state->callback(xint);
+
+  PieCtrlRegs.PIEACK.all = XINT_RESOURCES[xint].ack;
+}
+
+//counter is read as first, so ISR prologue is included at latency
+static __interrupt void XINT1_ISR(void)
+{
+  XINT_DISPATCH(XINT_1, XintRegs.XINT1CTR);
+}
+
+static __interrupt void XINT2_ISR(void)
+{
+  XINT_DISPATCH(XINT_2, XintRegs.XINT2CTR);
+}
+
+static __interrupt void XINT3_ISR(void)
+{
+  XINT_DISPATCH(XINT_3, XintRegs.XINT3CTR);
+}
+
+static __interrupt void XINT4_ISR(void)
+{
+  XINT_DISPATCH(XINT_4, 0);
+}
+
+static __interrupt void XINT5_ISR(void)
+{
+  XINT_DISPATCH(XINT_5, 0);
+}
+
+static volatile Uint16* XINT_CONTROL(XINTType xint)
+{
+  return &XintRegs.XINT1CR.all + xint;
+}
+
+static err_xint XINT_CHECK(XINTType xint)
+{
+  return ((uint32_t)xint < XINT_NUMBER) ? E_XINT_OK : E_XINT_INVALID_PARAM;
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_xint xintCfg(XINTType xint, uint32_t pin, XINT_PolarityType polarity, XINT_Callback callback)
+{
+  err_xint ret = E_XINT_OK;
+  const XINT_Resource *resource = NULL;
+
+  if((XINT_CHECK(xint) != E_XINT_OK) || (pin >= GPIO_NUMBER_OF_PINS) || (callback == NULL) ||
+     ((polarity != XPOL_FALLING) && (polarity != XPOL_RISING) && (polarity != XPOL_BOTH)))
+  {
+    ret = E_XINT_INVALID_PARAM;
+  }
+  else
+  {
+    resource = &XINT_RESOURCES[xint];
+
+    *XINT_CONTROL(xint) = (Uint16)polarity << XINT_POLARITY_SHIFT;    //disabled until xintEnable()
+
+    xintState[xint].callback = callback;
+    xintState[xint].stats.count = 0;
+    xintState[xint].stats.latency = 0;
+    xintState[xint].stats.latencyMax = 0;
+
+    EALLOW;
+    (&InputXbarRegs.INPUT1SELECT)[resource->xbarInput] = (Uint16)pin;
+    switch(xint)
+    {
+      case XINT_1: PieVectTable.XINT1_INT = &XINT1_ISR; break;
+      case XINT_2: PieVectTable.XINT2_INT = &XINT2_ISR; break;
+      case XINT_3: PieVectTable.XINT3_INT = &XINT3_ISR; break;
+      case XINT_4: PieVectTable.XINT4_INT = &XINT4_ISR; break;
+      default:     PieVectTable.XINT5_INT = &XINT5_ISR; break;
+    }
+    EDIS;
+  }
+
+  return ret;
+}
+
+err_xint xintEnable(XINTType xint)
+{
+  err_xint ret = XINT_CHECK(xint);
+  const XINT_Resource *resource = NULL;
+
+  if(ret == E_XINT_OK)
+  {
+    if(xintState[xint].callback == NULL)
+    {
+      ret = E_XINT_NOT_INITIALIZE;
+    }
+    else
+    {
+      resource = &XINT_RESOURCES[xint];
+
+      (&PieCtrlRegs.PIEIER1.all)[resource->pieGroup] |= resource->pieMask;
+      IER |= resource->ack;
+      *XINT_CONTROL(xint) |= XINT_ENABLE;
+    }
+  }
+
+  return ret;
+}
+
+err_xint xintDisable(XINTType xint)
+{
+  err_xint ret = XINT_CHECK(xint);
+
+  if(ret == E_XINT_OK)
+  {
+    //PIE interrupt stays enabled, XINT does not generate new requests
+    *XINT_CONTROL(xint) &= ~XINT_ENABLE;
+  }
+
+  return ret;
+}
+
+err_xint xintStats(XINTType xint, XINT_Stats *stats)
+{
+  err_xint ret = XINT_CHECK(xint);
+
+  if((ret == E_XINT_OK) && (stats != NULL))
+  {
+    *stats = xintState[xint].stats;
+  }
+  else
+  {
+    ret = E_XINT_INVALID_PARAM;
+  }
+
+  return ret;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file DriverXINT.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of GPIO external interrupt driver. Pin is routed by Input X-BAR to XINT1 - XINT5 and
+ * callback is called from ISR of driver. XINT1 - XINT3 have counter which is reset at edge of pin and is
+ * read as first instruction of ISR, so latency from edge to ISR is measured in SYSCLK cycles.
+ *
+ *   pinGPIOCfg(&buttonPin);                                   //pin as input
+ *   xintCfg(XINT_1, 14, XPOL_FALLING, buttonPressed);
+ *   xintEnable(XINT_1);
+ */
+
+#ifndef DRIVERXINT_H_
+#define DRIVERXINT_H_
+
+#include <stdint.h>
+
+typedef int err_xint;
+
+/**
+ * @brief Numeric representation of XINT error
+ */
+#define E_XINT_OK                   0     //Operation successful
+#define E_XINT_INVALID_PARAM       -1     //Invalid parameters
+#define E_XINT_NOT_INITIALIZE      -2     //XINT is not configured
+
+/**
+ * @brief Numeric representation of external interrupt
+ */
+typedef enum
+{
+  XINT_MIN = -1,          //Not related to XINT, for debug purpose
+
+  XINT_1,                 //Input X-BAR INPUT4, PIE 1.4, with counter
+  XINT_2,                 //Input X-BAR INPUT5, PIE 1.5, with counter
+  XINT_3,                 //Input X-BAR INPUT6, PIE 12.1, with counter
+  XINT_4,                 //Input X-BAR INPUT13, PIE 12.2
+  XINT_5,                 //Input X-BAR INPUT14, PIE 12.3
+  XINT_MAX                //Not related to XINT, for debug purpose
+
+} XINTType;
+
+/**
+ * @brief Edge of pin which generate interrupt
+ */
+typedef enum
+{
+  XPOL_MIN = -1,          //Not related to XINT, for debug purpose
+
+  XPOL_FALLING,           //falling edge
+  XPOL_RISING,            //rising edge
+  XPOL_BOTH = 3,          //falling and rising edge
+  XPOL_MAX                //Not related to XINT, for debug purpose
+
+} XINT_PolarityType;
+
+/**
+ * @brief Callback called from ISR of XINT, PIE is acknowledged after return
+ */
+typedef void (*XINT_Callback)(XINTType xint);
+
+/**
+ * @brief Statistics of XINT, updated by ISR
+ */
+typedef struct
+{
+  uint32_t count;             //number of interrupts
+  uint16_t latency;           //latency of last interrupt, SYSCLK cycles from edge to ISR. 0 for XINT4, XINT5
+  uint16_t latencyMax;        //the biggest latency
+} XINT_Stats;
+
+/**
+ * @brief Function used to route pin to XINT and register callback. Pin should be configured as input by
+ * pinGPIOCfg(). XINT is disabled by this function.
+ *
+ * @param XINTType xint - external interrupt
+ * @param uint32_t pin - number of pin
+ * @param XINT_PolarityType polarity - edge of pin which generate interrupt
+ * @param XINT_Callback callback - function called from ISR, can not be NULL
+ *
+ * @return Status of operation
+ */
+err_xint
+xintCfg(XINTType xint, uint32_t pin, XINT_PolarityType polarity, XINT_Callback callback);
+
+/**
+ * @brief Function used to enable XINT, its PIE interrupt and CPU interrupt group. Global interrupts (EINT)
+ * are not changed.
+ *
+ * @param XINTType xint - external interrupt configured by xintCfg()
+ *
+ * @return Status of operation
+ */
+err_xint
+xintEnable(XINTType xint);
+
+/**
+ * @brief Function used to disable XINT
+ *
+ * @param XINTType xint - external interrupt
+ *
+ * @return Status of operation
+ */
+err_xint
+xintDisable(XINTType xint);
+
+/**
+ * @brief Function used to read statistics of XINT
+ *
+ * @param XINTType xint - external interrupt
+ * @param XINT_Stats *stats - pointer where statistics are written
+ *
+ * @return Status of operation
+ */
+err_xint
+xintStats(XINTType xint, XINT_Stats *stats);
+
+#endif /* DRIVERXINT_H_ */
@@ -0,0 +1,1015 @@
+/**
+ * @file HostBench.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Cycle-accounting benchmark of driver entry points. Host program, compiled only with HOST_SIM
+ * define together with library and main.c (for ISR), i.e:
+ *
+ *   gcc -DHOST_SIM -I. -Iinclude *.c -o hostbench
+ *
+ * Every scenario is run once as a warm-up, once measured by HostSim_MeasureStart/Stop and once recorded
+ * by HostTrace, then table with host instructions, register accesses, estimated C28x cycles, redundant
+ * writes and repeated reads is printed.
+ */
+
+#ifdef HOST_SIM
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "F2837xS_device.h"
+#include "HostSim.h"
+#include "HostTrace.h"
+#include "DriverGPIO.h"
+#include "DriverSPI.h"
+#include "DriverSPIQueue.h"
+#include "DriverSPIBench.h"
+#include "HostModel.h"
+#include "DriverDebounce.h"
+#include "DriverXINT.h"
+#include "DriverDMA.h"
+#include "DriverDMABuffer.h"
+#include "DriverDMACopy.h"
+#include "DriverDMASched.h"
+#include "DriverADC.h"
+
+//ISR and init from main.c
+interrupt void timer0(void);
+void initGpio(void);
+void initADC(void);
+
+#define BENCH_PIN           12
+#define BENCH_TRACE_SIZE    65536     //size of trace buffer of one scenario
+
+/**
+ * @brief One benchmark scenario
+ */
+typedef struct
+{
+  const char *name;             //name printed at report
+  void (*setup)(void);          //prepare register files, not measured. Can be NULL
+  int32_t (*run)(void);         //measured call, return value of driver
+} HostBench_Scenario;
+
+static GPIOCfg_Type benchPin =
+{
+  BENCH_PIN,                    //pin
+  0,                            //samplingPeriod
+  MUX_0,                        //pinFunction
+  QSEL_SYNC,                    //samplingQualification
+  DIR_Output,                   //direction
+  PUD_Enable,                   //pull
+  INV_InvertDisable,            //invert
+  ODR_NormalOutput,             //type
+  CORE_CPU1                     //core
+};
+
+GPIO_CFG_STATIC(benchPinStatic, BENCH_PIN, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable,
+                ODR_NormalOutput, CORE_CPU1);
+
+#define BENCH_PINS(X, a, b)                                                                                        \
+  X(a, b, 2, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)          \
+  X(a, b, 3, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)          \
+  X(a, b, 4, 0, MUX_0, QSEL_SYNC, DIR_Input, PUD_Disable, INV_InvertEnable, ODR_NormalOutput, CORE_CPU1)           \
+  X(a, b, BENCH_PIN, 0, MUX_0, QSEL_SYNC, DIR_Output, PUD_Enable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)  \
+  X(a, b, 58, 0, MUX_15, QSEL_Async, DIR_Input, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)       \
+  X(a, b, 59, 0, MUX_15, QSEL_Async, DIR_Input, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)       \
+  X(a, b, 60, 0, MUX_15, QSEL_Async, DIR_Output, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)      \
+  X(a, b, 61, 0, MUX_15, QSEL_Async, DIR_Output, PUD_Disable, INV_InvertDisable, ODR_NormalOutput, CORE_CPU1)
+
+GPIO_MAP_TABLE(benchPinMap, BENCH_PINS);
+GPIO_MAP_IMAGE(benchPinImage, BENCH_PINS);
+
+#define BENCH_PIN_MAP_NUMBER    (sizeof(benchPinMap) / sizeof(benchPinMap[0]))
+
+static SPI_Cfg benchSpi =
+{
+  SPI_A,                        //spi
+  MODE_MASTER,                  //mode
+  POL_RISING,                   //polarity
+  WORD_16b,                     //word_size
+  9,                            //baud_rate
+  PHA_NORMAL,                   //phase
+  FIFO_ON,                      //fifo_set
+  FIFO_LVL_8                    //fifo_lvl
+};
+
+//******************************************************SCENARIOS********************************************************
+
+static void SETUP_PIN(void)
+{
+  pinGPIOCfg(&benchPin);
+}
+
+static int32_t RUN_GPIO_CFG(void)
+{
+  return pinGPIOCfg(&benchPin);
+}
+
+static int32_t RUN_GPIO_CFG_STATIC(void)
+{
+  return pinGPIOCfgStatic(&benchPinStatic);
+}
+
+static int32_t RUN_GPIO_CFG_MAP(void)
+{
+  return pinGPIOCfgMap(benchPinMap, BENCH_PIN_MAP_NUMBER);
+}
+
+static int32_t RUN_GPIO_CFG_MAP_STATIC(void)
+{
+  return pinGPIOCfgMapStatic(benchPinMap, BENCH_PIN_MAP_NUMBER);
+}
+
+static int32_t RUN_GPIO_CFG_IMAGE(void)
+{
+  return pinGPIOCfgImage(&benchPinImage);
+}
+
+static GPIOPin_Type benchHandle;
+
+static void SETUP_HANDLE(void)
+{
+  pinGPIOCfg(&benchPin);
+  pinGPIOHandle(BENCH_PIN, &benchHandle);
+}
+
+static int32_t RUN_HANDLE_SET(void)
+{
+  pinGPIOHandleSet(&benchHandle);
+  return 0;
+}
+
+static int32_t RUN_HANDLE_TOOGLE(void)
+{
+  pinGPIOHandleToogle(&benchHandle);
+  return 0;
+}
+
+static int32_t RUN_HANDLE_READ(void)
+{
+  return (int32_t)pinGPIOHandleRead(&benchHandle);
+}
+
+static const uint32_t benchPinList[] = { 2, 3, 4, 40, 41, 99 };
+static GPIOPortMask_Type benchPorts;
+
+static void SETUP_PORTS(void)
+{
+  pinGPIOListMask(benchPinList, sizeof(benchPinList) / sizeof(benchPinList[0]), &benchPorts);
+}
+
+static int32_t RUN_PORT_WRITE(void)
+{
+  return portGPIOWrite(PORT_A, 0x1CUL, 0x14UL);
+}
+
+static int32_t RUN_PORT_READ(void)
+{
+  return (int32_t)portGPIORead(PORT_A);
+}
+
+static int32_t RUN_PORT_MASK_SET(void)
+{
+  portGPIOMaskSet(&benchPorts);
+  return 0;
+}
+
+static void SETUP_DEBOUNCE(void)
+{
+  debounceInit();
+  debouncePortAdd(PORT_A, 0x0000FFFFUL);
+  debouncePortAdd(PORT_B, 0x3C000000UL);
+
+  //every pin changes, last sample before edge
+  GpioDataRegs.GPADAT.all = 0x0000A5A5UL;
+  GpioDataRegs.GPBDAT.all = 0x14000000UL;
+  debounceTick();
+  debounceTick();
+  debounceTick();
+}
+
+static int32_t RUN_DEBOUNCE_TICK(void)
+{
+  debounceTick();
+  return 0;
+}
+
+static uint32_t benchXintCalls;
+
+static void BENCH_XINT_CALLBACK(XINTType xint)
+{
+  (void)xint;
+  benchXintCalls++;
+}
+
+static void SETUP_XINT(void)
+{
+  xintCfg(XINT_1, BENCH_PIN, XPOL_FALLING, BENCH_XINT_CALLBACK);
+  xintEnable(XINT_1);
+  XintRegs.XINT1CTR = 42;             //cycles from edge
+}
+
+static int32_t RUN_XINT_CFG(void)
+{
+  return xintCfg(XINT_3, BENCH_PIN, XPOL_BOTH, BENCH_XINT_CALLBACK);
+}
+
+static int32_t RUN_ISR_XINT1(void)
+{
+  PieVectTable.XINT1_INT();
+  return 0;
+}
+
+static int32_t RUN_GPIO_SET(void)
+{
+  return pinGPIOSet(BENCH_PIN, GPIO_SET);
+}
+
+static int32_t RUN_GPIO_TOOGLE(void)
+{
+  return pinGPIOToogle(BENCH_PIN);
+}
+
+static int32_t RUN_GPIO_READ(void)
+{
+  return (int32_t)pinGPIORead(BENCH_PIN);
+}
+
+static int32_t RUN_SPI_CFG(void)
+{
+  return spiCfg(&benchSpi);
+}
+
+static SPI_Cfg benchSpiBaud;
+
+static void SETUP_SPI_CFG(void)
+{
+  spiCfg(&benchSpi);
+  benchSpiBaud = benchSpi;
+  benchSpiBaud.baud_rate = 19;
+}
+
+static int32_t RUN_SPI_CFG_BAUD(void)
+{
+  return spiCfg(&benchSpiBaud);
+}
+
+SPI_CFG_STATIC(benchSpiStatic, SPI_A, MODE_MASTER, POL_RISING, WORD_16b, 19, PHA_NORMAL, FIFO_ON, FIFO_LVL_8);
+
+static int32_t RUN_SPI_CFG_STATIC(void)
+{
+  return spiCfgStatic(&benchSpiStatic);
+}
+
+static int32_t RUN_SPI_BAUD_SET(void)
+{
+  uint32_t achieved = 0;
+
+  //LSPCLK is 10 MHz after reset, so bit rate is up to 2.5 MHz
+  return spiBaudSet(SPI_A, 2000000UL, &achieved);
+}
+
+static uint16_t benchSpiBuff[32];
+
+//DMA channels of SPI_A are allocated by spiCfg()
+static DMA_ChannelType benchSpiTx = DMA_CH_MIN;
+static DMA_ChannelType benchSpiRx = DMA_CH_MIN;
+
+static void SETUP_SPI(void)
+{
+  SPI_Cfg fifoOff = benchSpi;
+
+  //registers are cleared by HostSim_Reset(), so FIFO settings are changed twice and spiCfg() writes FIFO,
+  //DMA and PIE vectors again instead of using its shadow
+  fifoOff.fifo_set = FIFO_OFF;
+  spiCfg(&fifoOff);
+  spiCfg(&benchSpi);
+  spiBusy(SPI_A);
+  spiDmaChannels(SPI_A, &benchSpiTx, &benchSpiRx);
+}
+
+static int32_t RUN_SPI_SEND(void)
+{
+  return spiSend(SPI_A, benchSpiBuff, 32);
+}
+
+static int32_t RUN_SPI_TRANSFER(void)
+{
+  return spiTransfer(SPI_A, benchSpiBuff, benchSpiBuff, 32);
+}
+
+static int32_t RUN_SPI_TRANSFER_FIFO(void)
+{
+  return spiTransferFIFO(SPI_A, benchSpiBuff, benchSpiBuff, 32);
+}
+
+static void SETUP_SPI_FIFO(void)
+{
+  SETUP_SPI();
+  spiTransferFIFO(SPI_A, benchSpiBuff, benchSpiBuff, 32);
+  SpiaRegs.SPIFFRX.bit.RXFFST = FIFO_LVL_8;      //watermark reached
+}
+
+static int32_t RUN_ISR_SPI_RX(void)
+{
+  PieVectTable.SPIA_RX_INT();
+  return 0;
+}
+
+static SPI_Device benchSpiDevices[2] =
+{
+  { { POL_RISING, PHA_NORMAL, WORD_16b, 9 }, 12, { NULL, 0 } },      //cs is set by spiQueueDeviceInit()
+  { { POL_FALLING, PHA_DELAY, WORD_8b, 19 }, 13, { NULL, 0 } },
+};
+static SPI_Transaction benchSpiTransactions[2];
+
+static void SETUP_QUEUE(void)
+{
+  uint16_t i = 0;
+
+  SETUP_SPI();
+  spiQueueInit(SPI_A);
+  for(i = 0; i < 2; i++)
+  {
+    spiQueueDeviceInit(&benchSpiDevices[i]);
+    benchSpiTransactions[i].device = &benchSpiDevices[i];
+    benchSpiTransactions[i].sendbuff = benchSpiBuff;
+    benchSpiTransactions[i].readbuff = benchSpiBuff;
+    benchSpiTransactions[i].length = 16;
+  }
+}
+
+static int32_t RUN_QUEUE_POST(void)
+{
+  return spiQueuePost(SPI_A, &benchSpiTransactions[0], SPI_PRIO_NORMAL);
+}
+
+static void BENCH_SPI_DMA_ISR(void)
+{
+  (*(&PieVectTable.DMA_CH1_INT + benchSpiRx))();
+}
+
+static void SETUP_NEXT(void)
+{
+  SETUP_QUEUE();
+  spiQueuePost(SPI_A, &benchSpiTransactions[0], SPI_PRIO_NORMAL);
+  spiQueuePost(SPI_A, &benchSpiTransactions[1], SPI_PRIO_NORMAL);
+}
+
+static int32_t RUN_ISR_QUEUE_NEXT(void)
+{
+  BENCH_SPI_DMA_ISR();
+  return 0;
+}
+
+static uint16_t benchSpiRing[64];
+
+static void BENCH_STREAM_BLOCK(SPIType spi, uint16_t *block, uint16_t half)
+{
+  (void)block;
+  spiStreamRelease(spi, half);
+}
+
+static void SETUP_STREAM(void)
+{
+  SPI_Cfg slave = benchSpi;
+
+  SETUP_SPI();
+  slave.mode = MODE_SLAVE;
+  spiCfg(&slave);
+  spiStreamStart(SPI_A, benchSpiRing, 32, BENCH_STREAM_BLOCK);
+  BENCH_SPI_DMA_ISR();                            //start of the first block
+}
+
+static int32_t RUN_ISR_STREAM(void)
+{
+  BENCH_SPI_DMA_ISR();
+  return 0;
+}
+
+static uint16_t benchFrameCommands[16];
+static uint16_t benchFramePool[4 * 16 * 4];
+static SPI_Frame benchFrames[4];
+
+static const SPI_FrameCfg benchFrameCfg =
+{
+  SPI_A,                                        //spi
+  DMA_TRIGGER_EPWM_SOCA(1),                     //trigger
+  benchFrameCommands,                           //commands
+  16,                                           //channels
+  4,                                            //samples
+  benchFramePool,                               //pool
+  benchFrames,                                  //frames
+  4,                                            //depth
+  &CpuTimer2Regs.TIM.all,                       //clock
+  NULL                                          //callback
+};
+
+static void SETUP_FRAME(void)
+{
+  SETUP_SPI();
+  spiFrameStart(&benchFrameCfg);
+}
+
+static int32_t RUN_ISR_FRAME(void)
+{
+  BENCH_SPI_DMA_ISR();
+  return 0;
+}
+
+static uint16_t benchDmaSource[128];
+static uint16_t benchDmaDestination[128];
+static DMA_ChannelType benchDma = DMA_CH_MIN;
+
+static void BENCH_DMA_DONE(DMA_ChannelType channel)
+{
+  (void)channel;
+}
+
+static const DMA_Transfer benchDmaTransfer =
+{
+  benchDmaSource,                               //source
+  benchDmaDestination,                          //destination
+  16, 1, 1,                                     //burst, srcBurstStep, dstBurstStep
+  4, 1, 1,                                      //transfers, srcTransferStep, dstTransferStep
+  DMA_WRAP_NONE, 0, DMA_WRAP_NONE, 0,           //srcWrap, srcWrapStep, dstWrap, dstWrapStep
+  DMA_TRIGGER_SOFTWARE,                         //trigger
+  DMA_SIZE_32,                                  //size
+  DMA_TRANSFER_ONESHOT,                         //mode
+  BENCH_DMA_DONE                                //callback
+};
+
+//channel is kept by driver between scenarios, registers are cleared by HostSim_Reset()
+static void SETUP_DMA(void)
+{
+  if(benchDma == DMA_CH_MIN)
+  {
+    dmaAlloc(&benchDma);
+  }
+}
+
+static int32_t RUN_DMA_START(void)
+{
+  return dmaStart(benchDma, &benchDmaTransfer);
+}
+
+static void SETUP_DMA_ISR(void)
+{
+  SETUP_DMA();
+  dmaStart(benchDma, &benchDmaTransfer);
+}
+
+static int32_t RUN_ISR_DMA(void)
+{
+  (*(&PieVectTable.DMA_CH1_INT + benchDma))();
+  return 0;
+}
+
+static uint16_t benchBufferPool[4 * 64];
+
+static const DMA_Transfer benchBufferTransfer =
+{
+  &AdcaResultRegs.ADCRESULT0,                   //source
+  benchBufferPool,                              //destination, taken from pool
+  1, 0, 0,                                      //burst, srcBurstStep, dstBurstStep
+  64, 0, 1,                                     //transfers, srcTransferStep, dstTransferStep
+  DMA_WRAP_NONE, 0, DMA_WRAP_NONE, 0,           //srcWrap, srcWrapStep, dstWrap, dstWrapStep
+  DMA_TRIGGER_ADCA(1),                          //trigger
+  DMA_SIZE_16,                                  //size
+  DMA_TRANSFER_BURST,                           //mode
+  NULL                                          //callback
+};
+
+static const DMA_BufferCfg benchBufferCfg = { &benchBufferTransfer, benchBufferPool, 64, 4, NULL };
+
+//the first interrupt only arms shadow, so the measured one publishes buffer
+static void SETUP_BUFFER(void)
+{
+  SETUP_DMA();
+  dmaBufferStop(benchDma);
+  dmaBufferStart(benchDma, &benchBufferCfg);
+  (*(&PieVectTable.DMA_CH1_INT + benchDma))();
+}
+
+static int32_t RUN_BUFFER_GET(void)
+{
+  uint16_t index = 0;
+  void *buffer = NULL;
+  err_dma ret = dmaBufferGet(benchDma, &index, &buffer);
+
+  return (ret == E_DMA_OK) ? dmaBufferRelease(benchDma) : ret;
+}
+
+static void SETUP_READY(void)
+{
+  SETUP_BUFFER();
+  RUN_ISR_DMA();
+}
+
+//ADC results at 10 kHz at DMA_CH1, McBSP at 50 kHz, SYSCLK 200 MHz
+static DMA_SchedStream benchSched[] =
+{
+  { 4000, 4000, 2, DMA_SIZE_32, DMA_CH_MIN, 0 },
+  { 20000, 2000, 16, DMA_SIZE_16, DMA_CH_MIN, 0 },
+};
+
+//DMA_CH1 needs 129 cycles of every 100
+static DMA_SchedStream benchSchedOverload[] =
+{
+  { 100, 100, 32, DMA_SIZE_16, DMA_CH_MIN, 0 },
+  { 4000, 4000, 2, DMA_SIZE_32, DMA_CH_MIN, 0 },
+};
+
+//configuration is kept by driver between scenarios, so it is released before the next one
+static void SETUP_SCHED(void)
+{
+  dmaSchedFree();
+  dmaSchedCfg(benchSched, 2, 200);
+}
+
+static int32_t RUN_SCHED_CFG_OVERLOAD(void)
+{
+  return dmaSchedCfg(benchSchedOverload, 2, 200);
+}
+
+static int32_t RUN_SCHED_SAMPLE(void)
+{
+  dmaSchedSample();
+  return 0;
+}
+
+static DMA_SchedStream benchSchedSpi[] =
+{
+  { 4000, 4000, 2, DMA_SIZE_32, DMA_CH_MIN, 0 },
+  { 20000, 2000, 16, DMA_SIZE_16, DMA_CH_MIN, 0 },
+};
+
+//SPI_C with DMA is configured before scheduler, DMA_CH1 must be still free for the shortest deadline
+static void SETUP_SPIC(void)
+{
+  SPI_Cfg spic = benchSpi;
+
+  dmaSchedFree();
+  if(benchDma != DMA_CH_MIN)
+  {
+    dmaBufferStop(benchDma);
+    dmaFree(benchDma);
+    benchDma = DMA_CH_MIN;
+  }
+  spic.spi = SPI_C;
+  spiCfg(&spic);
+}
+
+static int32_t RUN_SCHED_CFG_SPI(void)
+{
+  return dmaSchedCfg(benchSchedSpi, 2, 200);
+}
+
+static int32_t RUN_ISR_TIMER0(void)
+{
+  timer0();
+  return 0;
+}
+
+//16 phase currents and voltages, 4 SOCs of every converter at ePWM1 SOCA, the last SOC ends sequence
+#define BENCH_ADC_SOC(adc, irq)                                                                                   \
+  { adc, 0, 0, ADC_TRIGGER_EPWM_SOCA(1), ADC_ACQPS_MIN, ADC_INT_NONE },                                           \
+  { adc, 1, 1, ADC_TRIGGER_EPWM_SOCA(1), ADC_ACQPS_MIN, ADC_INT_NONE },                                           \
+  { adc, 2, 2, ADC_TRIGGER_EPWM_SOCA(1), ADC_ACQPS_MIN, ADC_INT_NONE },                                           \
+  { adc, 3, 3, ADC_TRIGGER_EPWM_SOCA(1), ADC_ACQPS_MIN, irq }
+
+static const ADC_Channel benchAdcChannels[] =
+{
+  BENCH_ADC_SOC(ADC_A, ADC_INT1),
+  BENCH_ADC_SOC(ADC_B, ADC_INT1),
+  BENCH_ADC_SOC(ADC_C, ADC_INT1),
+  BENCH_ADC_SOC(ADC_D, ADC_INT2),
+};
+
+static const ADC_Cfg benchAdc =
+{
+  benchAdcChannels, 16, ADC_DIV_4_0,
+  &CpuTimer2Regs.TIM.all, ADC_SETTLE_CYCLES(200),
+  NULL
+};
+
+static int32_t RUN_ADC_CFG(void)
+{
+  return adcCfg(&benchAdc);
+}
+
+//timer is not modelled outside of measurement, so settling time is moved by hand
+static void SETUP_SETTLED(void)
+{
+  adcCfg(&benchAdc);
+  CpuTimer2Regs.TIM.all -= benchAdc.settle;
+}
+
+static int32_t RUN_ADC_READY(void)
+{
+  return adcReady();
+}
+
+static int32_t RUN_ADC_RESULTS(void)
+{
+  uint16_t values[4];
+
+  return adcResults(ADC_D, 0, 4, values);
+}
+
+static int32_t RUN_ISR_ADC0(void)
+{
+  PieVectTable.ADCA1_INT();
+  return 0;
+}
+
+static const HostBench_Scenario BENCH_SCENARIOS[] =
+{
+  { "pinGPIOCfg",           NULL,           RUN_GPIO_CFG             },
+  { "pinGPIOCfgStatic",     NULL,           RUN_GPIO_CFG_STATIC      },
+  { "pinGPIOCfgMap",        NULL,           RUN_GPIO_CFG_MAP         },
+  { "pinGPIOCfgMapStatic",  NULL,           RUN_GPIO_CFG_MAP_STATIC  },
+  { "pinGPIOCfgImage",      NULL,           RUN_GPIO_CFG_IMAGE       },
+  { "pinGPIOSet",           SETUP_PIN,      RUN_GPIO_SET             },
+  { "pinGPIOToogle",        SETUP_PIN,      RUN_GPIO_TOOGLE          },
+  { "pinGPIORead",          SETUP_PIN,      RUN_GPIO_READ            },
+  { "spiCfg",               NULL,           RUN_SPI_CFG              },
+  { "spiCfg baud",          SETUP_SPI_CFG,  RUN_SPI_CFG_BAUD         },
+  { "spiCfgStatic baud",    SETUP_SPI_CFG,  RUN_SPI_CFG_STATIC       },
+  { "spiBaudSet",           SETUP_SPI_CFG,  RUN_SPI_BAUD_SET         },
+  { "spiSend",              SETUP_SPI,      RUN_SPI_SEND             },
+  { "spiTransfer",          SETUP_SPI,      RUN_SPI_TRANSFER         },
+  { "spiTransferFIFO",      SETUP_SPI,      RUN_SPI_TRANSFER_FIFO    },
+  { "ISR spia rx",          SETUP_SPI_FIFO, RUN_ISR_SPI_RX           },
+  { "spiQueuePost",         SETUP_QUEUE,    RUN_QUEUE_POST           },
+  { "ISR spi queue next",   SETUP_NEXT,     RUN_ISR_QUEUE_NEXT       },
+  { "ISR spi stream",       SETUP_STREAM,   RUN_ISR_STREAM           },
+  { "ISR spi frame",        SETUP_FRAME,    RUN_ISR_FRAME            },
+  { "pinGPIOHandleSet",     SETUP_HANDLE,   RUN_HANDLE_SET           },
+  { "pinGPIOHandleToogle",  SETUP_HANDLE,   RUN_HANDLE_TOOGLE        },
+  { "pinGPIOHandleRead",    SETUP_HANDLE,   RUN_HANDLE_READ          },
+  { "portGPIOWrite",        NULL,           RUN_PORT_WRITE           },
+  { "portGPIORead",         NULL,           RUN_PORT_READ            },
+  { "portGPIOMaskSet",      SETUP_PORTS,    RUN_PORT_MASK_SET        },
+  { "debounceTick",         SETUP_DEBOUNCE, RUN_DEBOUNCE_TICK        },
+  { "xintCfg",              NULL,           RUN_XINT_CFG             },
+  { "ISR xint1",            SETUP_XINT,     RUN_ISR_XINT1            },
+  { "dmaStart",             SETUP_DMA,      RUN_DMA_START            },
+  { "ISR dma",              SETUP_DMA_ISR,  RUN_ISR_DMA              },
+  { "ISR dma buffer",       SETUP_BUFFER,   RUN_ISR_DMA              },
+  { "dmaBufferGet",         SETUP_READY,    RUN_BUFFER_GET           },
+  { "dmaSchedCfg overload", NULL,           RUN_SCHED_CFG_OVERLOAD   },
+  { "dmaSchedSample",       SETUP_SCHED,    RUN_SCHED_SAMPLE         },
+  { "dmaSchedCfg SPI_C",    SETUP_SPIC,     RUN_SCHED_CFG_SPI        },
+  { "ISR timer0",           initGpio,       RUN_ISR_TIMER0           },
+  { "ISR adc0",             initADC,        RUN_ISR_ADC0             },
+  { "adcCfg 16 SOC",        NULL,           RUN_ADC_CFG              },
+  { "adcReady",             SETUP_SETTLED,  RUN_ADC_READY            },
+  { "adcResults",           SETUP_SETTLED,  RUN_ADC_RESULTS          },
+};
+
+#define BENCH_SCENARIOS_NUMBER    (sizeof(BENCH_SCENARIOS) / sizeof(BENCH_SCENARIOS[0]))
+
+//******************************************************MAIN*************************************************************
+
+static void BENCH_PREPARE(const HostBench_Scenario *scenario)
+{
+  HostSim_Reset();
+
+  if(scenario->setup != NULL)
+  {
+    scenario->setup();
+  }
+}
+
+/**
+ * @brief Save trace of scenario to '<dir>/<scenario>.trc', spaces at name are changed to '_'
+ */
+static void BENCH_SAVE_TRACE(const char *dir, const char *name, const uint8_t *stream, uint32_t length)
+{
+  char path[256];
+  FILE *file = NULL;
+  int n = 0;
+  int i = 0;
+
+  n = snprintf(path, sizeof(path), "%s/", dir);
+  for(i = 0; (name[i] != 0) && (n < (int)sizeof(path) - 5); i++)
+  {
+    path[n++] = (name[i] == ' ') ? '_' : name[i];
+  }
+  snprintf(path + n, sizeof(path) - n, ".trc");
+
+  file = fopen(path, "wb");
+  if(file != NULL)
+  {
+    fwrite(stream, 1, length, file);
+    fclose(file);
+  }
+}
+
+/**
+ * @brief Print trace file as text
+ */
+static int BENCH_PRINT_TRACE(const char *path)
+{
+  FILE *file = fopen(path, "rb");
+  uint8_t *stream = malloc(BENCH_TRACE_SIZE);
+  uint32_t length = 0;
+  int ret = 1;
+
+  if((file != NULL) && (stream != NULL))
+  {
+    length = fread(stream, 1, BENCH_TRACE_SIZE, file);
+    ret = (HostTrace_Print(stdout, stream, length) == E_TRACE_OK) ? 0 : 1;
+  }
+
+  if(file != NULL)
+  {
+    fclose(file);
+  }
+  free(stream);
+  return ret;
+}
+
+#define BENCH_DROP_WORDS            64
+#define BENCH_DROP_SERVICE          300       //calls of HostModel_Service() after drop, longer than transfer
+
+static uint16_t benchDropSend[BENCH_DROP_WORDS];
+static uint16_t benchDropRead[BENCH_DROP_WORDS];
+
+/**
+ * @brief Transfer of FIFO engine is dropped by spiCfg() with the same settings, then model runs longer than
+ * transfer. Return number of FIFO ISR and of words written to readbuff after drop, both must be 0.
+ */
+static uint32_t BENCH_DROP(void)
+{
+  SPI_Cfg reset = benchSpi;
+  HostSim_Measure measure;
+  SPI_Stats before;
+  SPI_Stats after;
+  uint32_t written = 0;
+  uint32_t i = 0;
+
+  reset.polarity = POL_FALLING;
+  reset.baud_rate = 19;
+  reset.fifo_set = FIFO_OFF;
+
+  HostSim_Reset();
+  EINT;
+  HostModel_Start();
+  HostSim_MeasureStart();
+
+  //shadow of driver is kept by HostSim_Reset(), so polarity, bit rate and FIFO are changed to write all
+  //registers again. Without loopback SPISOMI is high, so every received word is 0xFFFF
+  spiCfg(&reset);
+  spiCfg(&benchSpi);
+  for(i = 0; i < BENCH_DROP_WORDS; i++)
+  {
+    benchDropSend[i] = (uint16_t)(i * 0x9E37U);
+    benchDropRead[i] = 0;
+  }
+
+  spiTransferFIFO(SPI_A, benchDropSend, benchDropRead, BENCH_DROP_WORDS);
+  spiCfg(&benchSpi);                            //transfer is dropped
+  spiStats(SPI_A, &before);
+
+  for(i = 0; i < BENCH_DROP_SERVICE; i++)
+  {
+    HostModel_Service();
+  }
+  spiStats(SPI_A, &after);
+
+  HostSim_MeasureStop(&measure);
+  HostModel_Stop();
+
+  for(i = 0; i < BENCH_DROP_WORDS; i++)
+  {
+    written += (benchDropRead[i] != 0) ? 1 : 0;
+  }
+
+  printf("drop fifo: busy %u, isr %lu, written %lu\n", (unsigned)spiBusy(SPI_A),
+         (unsigned long)((after.rxIsr - before.rxIsr) + (after.txIsr - before.txIsr)), (unsigned long)written);
+
+  return (after.rxIsr - before.rxIsr) + (after.txIsr - before.txIsr) + written + spiBusy(SPI_A);
+}
+
+/**
+ * @brief Run spiBenchRun() with peripheral model and print table of results
+ */
+static int BENCH_LOOPBACK(void)
+{
+  static const char *const modes[SPI_BENCH_MAX] = { "polled", "fifo", "dma" };
+  SPI_BenchCfg config = { SPI_A, 3, FIFO_LVL_4, 32, 4 };
+  SPI_BenchReport report;
+  HostSim_Measure measure;
+  uint32_t errors = 0;
+  uint16_t mode = 0;
+  uint16_t word = 0;
+  err_spi ret = E_SPI_OK;
+
+  HostSim_Reset();
+  EINT;
+  HostModel_Start();
+  HostSim_MeasureStart();
+  ret = spiBenchRun(&config, &report);
+  HostSim_MeasureStop(&measure);
+  HostModel_Stop();
+
+  printf("%-8s %4s %6s %8s %8s %10s %12s %12s %14s\n", "mode", "bits", "status", "words", "errors", "cycles",
+         "latency_min", "latency_max", "bits/kcycle");
+
+  for(mode = 0; mode < SPI_BENCH_MAX; mode++)
+  {
+    for(word = 0; word < SPI_BENCH_WORDS; word++)
+    {
+      const SPI_BenchResult *result = &report.result[mode][word];
+
+      printf("%-8s %4u %6ld %8lu %8lu %10lu %12lu %12lu %14lu\n", modes[mode], (unsigned)(word + 1),
+             (long)result->status, (unsigned long)result->words, (unsigned long)result->errors,
+             (unsigned long)result->cycles, (unsigned long)result->latencyMin, (unsigned long)result->latencyMax,
+             (unsigned long)result->bitsPerKCycle);
+
+      errors += result->errors + ((result->status != E_SPI_OK) ? 1 : 0);
+    }
+  }
+
+  errors += BENCH_DROP();
+
+  printf("ret %d, c28x_cycles %lu, failed %lu\n", ret, (unsigned long)measure.cycles, (unsigned long)errors);
+  return ((ret == E_SPI_OK) && (errors == 0)) ? 0 : 1;
+}
+
+#define BENCH_COPY_WORDS            4096
+
+static uint16_t benchCopySource[BENCH_COPY_WORDS];
+static uint16_t benchCopyDestination[BENCH_COPY_WORDS];
+
+/**
+ * @brief Copy of block by CPU, reference of DMA copy
+ */
+static void BENCH_CPU_COPY(uint16_t *destination, const uint16_t *source, uint32_t length)
+{
+  uint32_t i = 0;
+
+  for(i = 0; i < length; i++)
+  {
+    destination[i] = source[i];
+  }
+}
+
+/**
+ * @brief Estimated SYSCLK cycles of DMA move made by transfers of full bursts of DMA_BURST_MAX words
+ */
+static uint32_t BENCH_DMA_CYCLES(uint32_t length, uint16_t wide)
+{
+  uint32_t elements = wide ? (length / 2) : length;
+  uint32_t burst = wide ? (DMA_BURST_MAX / 2) : DMA_BURST_MAX;
+
+  return elements * DMA_CYCLES_ELEMENT + ((elements + burst - 1) / burst) * DMA_CYCLES_BURST;
+}
+
+/**
+ * @brief Compare copy by CPU with dmaCopy() and dmaFill() with peripheral model. CPU cycles of DMA are cycles
+ * of call and of ISR which starts next transfers, the rest of time CPU is free.
+ */
+static int BENCH_COPY(void)
+{
+  static const uint32_t lengths[] = { 256, 1024, BENCH_COPY_WORDS, 1001 };
+  HostSim_Measure cpu;
+  HostSim_Measure dma;
+  uint32_t errors = 0;
+  uint32_t failed = 0;
+  uint32_t i = 0;
+  uint32_t j = 0;
+  err_dma ret = E_DMA_OK;
+
+  printf("%-6s %6s %6s %10s %10s %12s %8s\n", "op", "words", "status", "cpu_copy", "dma_cpu", "dma_cycles", "errors");
+
+  HostSim_Reset();
+  EINT;
+  dmaCopyInit();
+
+  for(i = 0; i <= sizeof(lengths) / sizeof(lengths[0]); i++)
+  {
+    uint16_t fill = (i == sizeof(lengths) / sizeof(lengths[0]));
+    uint32_t length = fill ? BENCH_COPY_WORDS : lengths[i];
+
+    for(j = 0; j < BENCH_COPY_WORDS; j++)
+    {
+      benchCopySource[j] = (uint16_t)(j * 7 + i);
+      benchCopyDestination[j] = 0;
+    }
+
+    HostSim_MeasureStart();
+    BENCH_CPU_COPY(benchCopyDestination, benchCopySource, length);
+    HostSim_MeasureStop(&cpu);
+    memset(benchCopyDestination, 0, sizeof(benchCopyDestination));
+
+    //ISR is dispatched by model at once, so measurement of call includes all next transfers
+    HostModel_Start();
+    HostSim_MeasureStart();
+    ret = fill ? dmaFill(benchCopyDestination, 0xA5A5, length, NULL) : dmaCopy(benchCopyDestination, benchCopySource, length, NULL);
+    while(dmaCopyBusy() && (ret == E_DMA_OK))
+    {
+      HostModel_Service();
+    }
+    HostSim_MeasureStop(&dma);
+    HostModel_Stop();
+
+    errors = 0;
+    for(j = 0; j < BENCH_COPY_WORDS; j++)
+    {
+      uint16_t expected = (j >= length) ? 0 : (fill ? 0xA5A5 : benchCopySource[j]);
+
+      errors += (benchCopyDestination[j] != expected) ? 1 : 0;
+    }
+    failed += errors + ((ret != E_DMA_OK) ? 1 : 0);
+
+    printf("%-6s %6lu %6d %10lu %10lu %12lu %8lu\n", fill ? "fill" : "copy", (unsigned long)length, ret,
+           (unsigned long)cpu.cycles, (unsigned long)dma.cycles, (unsigned long)BENCH_DMA_CYCLES(length, (length % 2) == 0),
+           (unsigned long)errors);
+  }
+
+  return (failed == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Usage:
+ *   hostbench                 - print table of all scenarios
+ *   hostbench <dir>           - print table and save register access trace of every scenario at <dir>
+ *   hostbench -p <file.trc>   - print saved trace as text
+ *   hostbench -l              - run SPI loopback self-test and benchmark with peripheral model, check that
+ *                               transfer of FIFO engine dropped by spiCfg() is stopped
+ *   hostbench -c              - compare CPU copy with DMA copy and fill engine with peripheral model
+ */
+int main(int argc, char *argv[])
+{
+  uint8_t *stream = NULL;
+  uint16_t i = 0;
+
+  if((argc == 3) && (strcmp(argv[1], "-p") == 0))
+  {
+    return BENCH_PRINT_TRACE(argv[2]);
+  }
+
+  if((argc == 2) && (strcmp(argv[1], "-l") == 0))
+  {
+    return BENCH_LOOPBACK();
+  }
+
+  if((argc == 2) && (strcmp(argv[1], "-c") == 0))
+  {
+    return BENCH_COPY();
+  }
+
+  //trace buffer must not be a global variable, see HostSim_AccessHook
+  stream = malloc(BENCH_TRACE_SIZE);
+  if(stream == NULL)
+  {
+    return 1;
+  }
+
+  printf("%-20s %6s %12s %10s %10s %8s %12s %10s %10s\n", "scenario", "ret", "instructions", "reg_reads", "reg_writes",
+         "eallow", "c28x_cycles", "redundant", "reread");
+
+  for(i = 0; i < BENCH_SCENARIOS_NUMBER; i++)
+  {
+    const HostBench_Scenario *scenario = &BENCH_SCENARIOS[i];
+    HostSim_Measure measure;
+    HostTrace_Stats stats;
+    uint32_t length = 0;
+    int32_t ret = 0;
+
+    //warm-up
+    BENCH_PREPARE(scenario);
+    scenario->run();
+
+    BENCH_PREPARE(scenario);
+    HostSim_MeasureStart();
+    ret = scenario->run();
+    HostSim_MeasureStop(&measure);
+
+    BENCH_PREPARE(scenario);
+    HostTrace_RecordStart(stream, BENCH_TRACE_SIZE);
+    scenario->run();
+    length = HostTrace_RecordStop(&stats);
+
+    if(argc == 2)
+    {
+      BENCH_SAVE_TRACE(argv[1], scenario->name, stream, length);
+    }
+
+    printf("%-20s %6ld %12lu %10lu %10lu %8lu %12lu %10lu %10lu\n", scenario->name, (long)ret,
+           (unsigned long)measure.instructions, (unsigned long)measure.regReads, (unsigned long)measure.regWrites,
+           (unsigned long)measure.eallow, (unsigned long)measure.cycles,
+           (unsigned long)stats.redundantWrites, (unsigned long)stats.repeatedReads);
+  }
+
+  free(stream);
+  return 0;
+}
+
+#endif /* HOST_SIM */
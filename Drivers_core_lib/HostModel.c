@@ -0,0 +1,867 @@
+/**
+ * @file HostModel.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of peripheral model for host simulation. Model is a hook of HostSim, so it runs at signal
+ * handler: it does not use libc and keeps its state at thread local variable. At every access to register
+ * files model is moved to current time (words shifted, DMA bursts, flags) before the access and effects of
+ * the access (write to SPITXBUF, write 1 to clear bits etc.) are applied after it. Whole file is compiled
+ * only with HOST_SIM define.
+ */
+
+#ifdef HOST_SIM
+
+#include <stdint.h>
+#include <string.h>
+#include "F2837xS_device.h"
+#include "HostSim.h"
+#include "HostModel.h"
+
+#define MODEL_SPI_NUMBER              3
+#define MODEL_DMA_NUMBER              6
+#define MODEL_TIMER_NUMBER            3
+#define MODEL_FIFO_DEPTH              16
+#define MODEL_DMA_LOOPS               64        //guard of bursts made at one moment
+
+/**
+ * @brief Bits of SPI registers
+ */
+#define MODEL_CCR_SPICHAR             0x000F
+#define MODEL_CCR_SPILBK              0x0010
+#define MODEL_CCR_SPISWRESET          0x0080
+#define MODEL_CTL_MASTER              0x0004
+#define MODEL_STS_BUFFULL             0x0020
+#define MODEL_STS_INT_FLAG            0x0040
+#define MODEL_STS_OVERRUN             0x0080
+#define MODEL_FF_LVL                  0x001F    //TXFFIL, RXFFIL
+#define MODEL_FF_IENA                 0x0020
+#define MODEL_FF_INTCLR               0x0040
+#define MODEL_FF_INT                  0x0080
+#define MODEL_FF_ST_SHIFT             8
+#define MODEL_FF_ST                   0x1F00
+#define MODEL_FF_RESET                0x2000    //TXFIFO, RXFIFORESET, 0 - FIFO is kept at reset
+#define MODEL_FFTX_SPIFFENA           0x4000
+#define MODEL_FFTX_SPIRST             0x8000
+#define MODEL_FFRX_OVFCLR             0x4000
+#define MODEL_FFRX_OVF                0x8000
+#define MODEL_SPI_BAUD_MIN            3         //SPIBRR 0 - 2 is LSPCLK / 4
+#define MODEL_SPI_TRIGGER             109       //SPITXDMAA, next are SPIRXDMAA, SPITXDMAB, SPIRXDMAB ...
+
+/**
+ * @brief Bits of DMA channel registers
+ */
+#define MODEL_MODE_PERINTE            0x0100
+#define MODEL_MODE_CHINTMODE          0x0200
+#define MODEL_MODE_ONESHOT            0x0400
+#define MODEL_MODE_CONTINUOUS         0x0800
+#define MODEL_MODE_DATASIZE           0x4000
+#define MODEL_MODE_CHINTE             0x8000
+#define MODEL_CONTROL_RUN             0x0001
+#define MODEL_CONTROL_HALT            0x0002
+#define MODEL_CONTROL_SOFTRESET       0x0004
+#define MODEL_CONTROL_PERINTFRC       0x0008
+#define MODEL_CONTROL_PERINTCLR       0x0010
+#define MODEL_CONTROL_ERRCLR          0x0080
+#define MODEL_CONTROL_PERINTFLG       0x0100
+#define MODEL_CONTROL_SYNCERR         0x0400
+#define MODEL_CONTROL_TRANSFERSTS     0x0800
+#define MODEL_CONTROL_BURSTSTS        0x1000
+#define MODEL_CONTROL_RUNSTS          0x2000
+#define MODEL_CONTROL_OVRFLG          0x4000
+#define MODEL_CONTROL_STATUS          0x7F00    //read-only bits, other bits read as 0
+
+/**
+ * @brief Bits of CPU timer and PIE
+ */
+#define MODEL_TCR_TSS                 0x0010
+#define MODEL_TCR_TRB                 0x0020
+#define MODEL_PIE_GROUPS              12
+#define MODEL_PIE_VECT_LOW            32        //index of INT1.1 at PieVectTable, INTx.1 - INTx.8
+#define MODEL_PIE_VECT_HIGH           128       //index of INT1.9, INTx.9 - INTx.16
+#define MODEL_PIE_SPI                 6         //group of SPI FIFO interrupts
+#define MODEL_PIE_DMA                 7         //group of DMA channel interrupts
+
+/**
+ * @brief True if access is made to 16-bit register, byte access of bit field is at odd address
+ */
+#define MODEL_IS(access, reg)         (((uintptr_t)(access)->address & ~(uintptr_t)1) == (uintptr_t)&(reg))
+
+/**
+ * @brief SPI state which is not visible at registers
+ */
+typedef struct
+{
+  uint16_t tx[MODEL_FIFO_DEPTH];
+  uint16_t txHead;
+  uint16_t txCount;
+  uint16_t rx[MODEL_FIFO_DEPTH];
+  uint16_t rxHead;
+  uint16_t rxCount;
+  uint16_t shifting;                 //word is at shift register
+  uint16_t word;
+  uint32_t doneAt;                   //cycle when the last bit of word is shifted
+  uint16_t txbuf;                    //word waiting at SPITXBUF, FIFO disabled
+  uint16_t txbufFull;
+} Model_Spi;
+
+typedef struct
+{
+  uint16_t running;
+  uint32_t value;                    //TIM at cycle 'start'
+  uint32_t start;
+} Model_Timer;
+
+typedef struct
+{
+  Model_Spi spi[MODEL_SPI_NUMBER];
+  Model_Timer timer[MODEL_TIMER_NUMBER];
+  uint16_t pieAck;                   //PIEACK, groups blocked until ISR acknowledge them
+  uint16_t before;                   //accessed register before instruction
+} Model_State;
+
+static __thread Model_State model;
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static volatile struct SPI_REGS* MODEL_SPI_REGS(uint16_t spi)
+{
+  return (spi == 0) ? &SpiaRegs : ((spi == 1) ? &SpibRegs : &SpicRegs);
+}
+
+static volatile struct CPUTIMER_REGS* MODEL_TIMER_REGS(uint16_t timer)
+{
+  return (timer == 0) ? &CpuTimer0Regs : ((timer == 1) ? &CpuTimer1Regs : &CpuTimer2Regs);
+}
+
+static volatile Uint16* MODEL_PIEIER(uint16_t group)
+{
+  return &PieCtrlRegs.PIEIER1.all + 2 * (group - 1);
+}
+
+static volatile Uint16* MODEL_PIEIFR(uint16_t group)
+{
+  return &PieCtrlRegs.PIEIER1.all + 2 * (group - 1) + 1;
+}
+
+/**
+ * @brief Index of SPI which contain address, MODEL_SPI_NUMBER if address is not at SPI
+ */
+static uint16_t MODEL_SPI_INDEX(volatile const void *address)
+{
+  uint16_t i = 0;
+
+  for(i = 0; i < MODEL_SPI_NUMBER; i++)
+  {
+    volatile const uint8_t *base = (volatile const uint8_t *)MODEL_SPI_REGS(i);
+
+    if(((volatile const uint8_t *)address >= base) && ((volatile const uint8_t *)address < base + sizeof(struct SPI_REGS)))
+    {
+      break;
+    }
+  }
+
+  return i;
+}
+
+static uint16_t MODEL_SPI_FIFO(volatile struct SPI_REGS *regs)
+{
+  return (regs->SPIFFTX.all & MODEL_FFTX_SPIFFENA) ? 1 : 0;
+}
+
+/**
+ * @brief SYSCLK cycles of one word, SPICLK is LSPCLK / (SPIBRR + 1)
+ */
+static uint32_t MODEL_SPI_CYCLES(volatile struct SPI_REGS *regs)
+{
+  uint32_t bits = (regs->SPICCR.all & MODEL_CCR_SPICHAR) + 1;
+  uint32_t brr = regs->SPIBRR.all & 0x7F;
+  uint32_t lsp = ClkCfgRegs.LOSPCP.bit.LSPCLKDIV;
+
+  if(brr < MODEL_SPI_BAUD_MIN)
+  {
+    brr = MODEL_SPI_BAUD_MIN;
+  }
+
+  return bits * (brr + 1) * ((lsp == 0) ? 1 : 2 * lsp);
+}
+
+/**
+ * @brief Start shift of waiting word at cycle 'at', only master generates SPICLK
+ */
+static void MODEL_SPI_START(uint16_t spi, uint32_t at)
+{
+  volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+  Model_Spi *m = &model.spi[spi];
+
+  if(m->shifting || !(regs->SPICCR.all & MODEL_CCR_SPISWRESET) || !(regs->SPICTL.all & MODEL_CTL_MASTER))
+  {
+    return;
+  }
+
+  if(MODEL_SPI_FIFO(regs))
+  {
+    if(m->txCount == 0)
+    {
+      return;
+    }
+    m->word = m->tx[m->txHead];
+    m->txHead = (m->txHead + 1) % MODEL_FIFO_DEPTH;
+    m->txCount--;
+  }
+  else
+  {
+    if(!m->txbufFull)
+    {
+      return;
+    }
+    m->word = m->txbuf;
+    m->txbufFull = 0;
+    regs->SPISTS.all &= ~MODEL_STS_BUFFULL;
+  }
+
+  m->shifting = 1;
+  m->doneAt = at + MODEL_SPI_CYCLES(regs);
+}
+
+/**
+ * @brief Word written to SPITXBUF by CPU or DMA
+ */
+static void MODEL_SPI_TX(uint16_t spi, uint16_t value, uint32_t at)
+{
+  volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+  Model_Spi *m = &model.spi[spi];
+
+  if(MODEL_SPI_FIFO(regs))
+  {
+    //word written to full FIFO is lost
+    if((regs->SPIFFTX.all & MODEL_FF_RESET) && (m->txCount < MODEL_FIFO_DEPTH))
+    {
+      m->tx[(m->txHead + m->txCount) % MODEL_FIFO_DEPTH] = value;
+      m->txCount++;
+    }
+  }
+  else
+  {
+    m->txbuf = value;
+    m->txbufFull = 1;
+    regs->SPISTS.all |= MODEL_STS_BUFFULL;
+  }
+
+  MODEL_SPI_START(spi, at);
+}
+
+/**
+ * @brief End of shift. SPIDAT is shifted left, at loopback the top bits of word come back at the bottom,
+ * without loopback SPISOMI is high.
+ */
+static void MODEL_SPI_RECEIVE(uint16_t spi)
+{
+  volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+  Model_Spi *m = &model.spi[spi];
+  uint16_t bits = (regs->SPICCR.all & MODEL_CCR_SPICHAR) + 1;
+  uint16_t in = (regs->SPICCR.all & MODEL_CCR_SPILBK) ? (uint16_t)(m->word >> (16 - bits)) : (uint16_t)((1UL << bits) - 1);
+  uint16_t value = (uint16_t)(((uint32_t)m->word << bits) | in);
+
+  m->shifting = 0;
+  regs->SPIDAT = value;
+
+  if(MODEL_SPI_FIFO(regs))
+  {
+    if(!(regs->SPIFFRX.all & MODEL_FF_RESET))
+    {
+      //FIFO is kept at reset, word is dropped
+    }
+    else if(m->rxCount < MODEL_FIFO_DEPTH)
+    {
+      m->rx[(m->rxHead + m->rxCount) % MODEL_FIFO_DEPTH] = value;
+      m->rxCount++;
+    }
+    else
+    {
+      regs->SPIFFRX.all |= MODEL_FFRX_OVF;
+    }
+  }
+  else
+  {
+    if(regs->SPISTS.all & MODEL_STS_INT_FLAG)
+    {
+      regs->SPISTS.all |= MODEL_STS_OVERRUN;
+    }
+    regs->SPIRXBUF = value;
+    regs->SPISTS.all |= MODEL_STS_INT_FLAG;
+  }
+}
+
+/**
+ * @brief Word read from SPIRXBUF by CPU or DMA
+ */
+static uint16_t MODEL_SPI_RX(uint16_t spi)
+{
+  volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+  Model_Spi *m = &model.spi[spi];
+  uint16_t value = regs->SPIRXBUF;
+
+  if(MODEL_SPI_FIFO(regs))
+  {
+    if(m->rxCount > 0)
+    {
+      value = m->rx[m->rxHead];
+      m->rxHead = (m->rxHead + 1) % MODEL_FIFO_DEPTH;
+      m->rxCount--;
+    }
+  }
+  else
+  {
+    regs->SPISTS.all &= ~MODEL_STS_INT_FLAG;
+  }
+
+  return value;
+}
+
+/**
+ * @brief Status of FIFO, flags and interrupts of group 6. Flag is set when level is reached and kept until
+ * it is cleared by TXFFINTCLR or RXFFINTCLR.
+ */
+static void MODEL_SPI_STATUS(uint16_t spi)
+{
+  volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+  Model_Spi *m = &model.spi[spi];
+  uint16_t rxBit = (spi == 0) ? 0x0001 : ((spi == 1) ? 0x0004 : 0x0100);     //INT6.1, INT6.3, INT6.9
+  uint16_t tx = regs->SPIFFTX.all;
+  uint16_t rx = regs->SPIFFRX.all;
+
+  if(!MODEL_SPI_FIFO(regs))
+  {
+    return;
+  }
+
+  tx = (tx & ~MODEL_FF_ST) | (m->txCount << MODEL_FF_ST_SHIFT);
+  if(m->txCount <= (tx & MODEL_FF_LVL))
+  {
+    tx |= MODEL_FF_INT;
+  }
+
+  rx = (rx & ~MODEL_FF_ST) | (m->rxCount << MODEL_FF_ST_SHIFT);
+  if(m->rxCount >= (rx & MODEL_FF_LVL))
+  {
+    rx |= MODEL_FF_INT;
+  }
+
+  regs->SPIFFTX.all = tx;
+  regs->SPIFFRX.all = rx;
+
+  if((tx & MODEL_FF_IENA) && (tx & MODEL_FF_INT))
+  {
+    *MODEL_PIEIFR(MODEL_PIE_SPI) |= rxBit << 1;
+  }
+  if((rx & MODEL_FF_IENA) && (rx & MODEL_FF_INT))
+  {
+    *MODEL_PIEIFR(MODEL_PIE_SPI) |= rxBit;
+  }
+}
+
+/**
+ * @brief Host address of 32-bit DMA address, buffs are at the same image as register files
+ */
+static volatile Uint16* MODEL_DMA_POINTER(Uint32 address)
+{
+  return (volatile Uint16 *)(((uintptr_t)&DmaRegs & ~(uintptr_t)0xFFFFFFFFUL) | (uintptr_t)address);
+}
+
+static uint16_t MODEL_DMA_READ(volatile Uint16 *address)
+{
+  uint16_t spi = MODEL_SPI_INDEX(address);
+
+  if((spi < MODEL_SPI_NUMBER) && (address == &MODEL_SPI_REGS(spi)->SPIRXBUF))
+  {
+    return MODEL_SPI_RX(spi);
+  }
+
+  return *address;
+}
+
+static void MODEL_DMA_WRITE(volatile Uint16 *address, uint16_t value, uint32_t at)
+{
+  uint16_t spi = MODEL_SPI_INDEX(address);
+
+  if((spi < MODEL_SPI_NUMBER) && (address == &MODEL_SPI_REGS(spi)->SPITXBUF))
+  {
+    *address = value;
+    MODEL_SPI_TX(spi, value, at);
+  }
+  else
+  {
+    *address = value;
+  }
+}
+
+/**
+ * @brief Peripheral request of trigger, SPI requests are levels of FIFO, other triggers are events latched
+ * at PERINTFLG by PERINTFRC
+ */
+static uint16_t MODEL_DMA_REQUEST(uint16_t channel)
+{
+  volatile Uint32 *select = &DmaClaSrcSelRegs.DMACHSRCSEL1.all + channel / 4;
+  uint16_t trigger = (*select >> (8 * (channel % 4))) & 0xFF;
+  volatile struct SPI_REGS *regs = NULL;
+  Model_Spi *m = NULL;
+  uint16_t ret = 0;
+
+  if((trigger >= MODEL_SPI_TRIGGER) && (trigger < MODEL_SPI_TRIGGER + 2 * MODEL_SPI_NUMBER))
+  {
+    regs = MODEL_SPI_REGS((trigger - MODEL_SPI_TRIGGER) / 2);
+    m = &model.spi[(trigger - MODEL_SPI_TRIGGER) / 2];
+
+    if(!MODEL_SPI_FIFO(regs))
+    {
+      ret = 0;
+    }
+    else if((trigger - MODEL_SPI_TRIGGER) % 2 == 0)
+    {
+      ret = (regs->SPIFFTX.all & MODEL_FF_RESET) && (m->txCount <= (regs->SPIFFTX.all & MODEL_FF_LVL));
+    }
+    else
+    {
+      ret = (regs->SPIFFRX.all & MODEL_FF_RESET) && (m->rxCount > 0) && (m->rxCount >= (regs->SPIFFRX.all & MODEL_FF_LVL));
+    }
+  }
+  else
+  {
+    ret = ((&DmaRegs.CH1 + channel)->CONTROL.all & MODEL_CONTROL_PERINTFLG) != 0;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Address after burst, transfer step or wrap to begin address moved by wrap step
+ */
+static Uint32 MODEL_DMA_NEXT(Uint32 address, int16 transferStep, volatile Uint32 *begin, volatile Uint16 *count,
+                             Uint16 size, int16 wrapStep)
+{
+  if(*count == 0)
+  {
+    *begin += 2 * (int32_t)wrapStep;
+    *count = size;
+    return *begin;
+  }
+
+  (*count)--;
+  return address + 2 * (int32_t)transferStep;
+}
+
+/**
+ * @brief One burst of channel. Active registers are loaded from shadow at start of transfer.
+ */
+static void MODEL_DMA_BURST(uint16_t channel, uint32_t at)
+{
+  volatile struct CH_REGS *ch = &DmaRegs.CH1 + channel;
+  uint16_t mode = ch->MODE.all;
+  uint16_t control = ch->CONTROL.all;
+  uint16_t size = (mode & MODEL_MODE_DATASIZE) ? 2 : 1;
+  uint16_t elements = ((ch->BURST_SIZE.all & 0x1F) + 1) / size;
+  Uint32 source = 0;
+  Uint32 destination = 0;
+  uint16_t i = 0;
+
+  if(!(control & MODEL_CONTROL_TRANSFERSTS))
+  {
+    ch->SRC_BEG_ADDR_ACTIVE = ch->SRC_BEG_ADDR_SHADOW;
+    ch->SRC_ADDR_ACTIVE = ch->SRC_ADDR_SHADOW;
+    ch->DST_BEG_ADDR_ACTIVE = ch->DST_BEG_ADDR_SHADOW;
+    ch->DST_ADDR_ACTIVE = ch->DST_ADDR_SHADOW;
+    ch->TRANSFER_COUNT = ch->TRANSFER_SIZE;
+    ch->SRC_WRAP_COUNT = ch->SRC_WRAP_SIZE;
+    ch->DST_WRAP_COUNT = ch->DST_WRAP_SIZE;
+    control |= MODEL_CONTROL_TRANSFERSTS;
+
+    if((mode & MODEL_MODE_CHINTE) && !(mode & MODEL_MODE_CHINTMODE))
+    {
+      *MODEL_PIEIFR(MODEL_PIE_DMA) |= 1U << channel;
+    }
+  }
+
+  //addresses of host are at bytes, step is at 16-bit words, 32-bit element is moved as two words
+  source = ch->SRC_ADDR_ACTIVE;
+  destination = ch->DST_ADDR_ACTIVE;
+  for(i = 0; i < elements; i++)
+  {
+    MODEL_DMA_WRITE(MODEL_DMA_POINTER(destination), MODEL_DMA_READ(MODEL_DMA_POINTER(source)), at);
+    if(size == 2)
+    {
+      MODEL_DMA_WRITE(MODEL_DMA_POINTER(destination + 2), MODEL_DMA_READ(MODEL_DMA_POINTER(source + 2)), at);
+    }
+    if(i + 1 < elements)
+    {
+      source += 2 * (int32_t)ch->SRC_BURST_STEP;
+      destination += 2 * (int32_t)ch->DST_BURST_STEP;
+    }
+  }
+  ch->SRC_ADDR_ACTIVE = MODEL_DMA_NEXT(source, ch->SRC_TRANSFER_STEP, &ch->SRC_BEG_ADDR_ACTIVE, &ch->SRC_WRAP_COUNT,
+                                       ch->SRC_WRAP_SIZE, ch->SRC_WRAP_STEP);
+  ch->DST_ADDR_ACTIVE = MODEL_DMA_NEXT(destination, ch->DST_TRANSFER_STEP, &ch->DST_BEG_ADDR_ACTIVE, &ch->DST_WRAP_COUNT,
+                                       ch->DST_WRAP_SIZE, ch->DST_WRAP_STEP);
+
+  //event is consumed by burst
+  control &= ~MODEL_CONTROL_PERINTFLG;
+  ch->CONTROL.all = control;
+
+  if(ch->TRANSFER_COUNT == 0)
+  {
+    control &= ~MODEL_CONTROL_TRANSFERSTS;
+    if(!(mode & MODEL_MODE_CONTINUOUS))
+    {
+      control &= ~MODEL_CONTROL_RUNSTS;
+    }
+    ch->CONTROL.all = control;
+
+    if((mode & MODEL_MODE_CHINTE) && (mode & MODEL_MODE_CHINTMODE))
+    {
+      *MODEL_PIEIFR(MODEL_PIE_DMA) |= 1U << channel;
+    }
+  }
+  else
+  {
+    ch->TRANSFER_COUNT--;
+  }
+}
+
+/**
+ * @brief Bursts of all running channels which have request, until no request is left
+ */
+static void MODEL_DMA_RUN(uint32_t at)
+{
+  uint16_t loops = 0;
+  uint16_t progress = 0;
+  uint16_t i = 0;
+
+  do
+  {
+    progress = 0;
+    for(i = 0; i < MODEL_DMA_NUMBER; i++)
+    {
+      volatile struct CH_REGS *ch = &DmaRegs.CH1 + i;
+
+      if((ch->CONTROL.all & MODEL_CONTROL_RUNSTS) && (ch->MODE.all & MODEL_MODE_PERINTE) && MODEL_DMA_REQUEST(i))
+      {
+        //one-shot channel makes all bursts of transfer at one event
+        do
+        {
+          MODEL_DMA_BURST(i, at);
+        } while((ch->MODE.all & MODEL_MODE_ONESHOT) && (ch->CONTROL.all & MODEL_CONTROL_TRANSFERSTS));
+        progress = 1;
+      }
+    }
+  } while(progress && (++loops < MODEL_DMA_LOOPS));
+}
+
+static void MODEL_DMA_CONTROL(uint16_t channel)
+{
+  volatile struct CH_REGS *ch = &DmaRegs.CH1 + channel;
+  uint16_t write = ch->CONTROL.all;
+  uint16_t status = model.before & MODEL_CONTROL_STATUS;
+
+  if(write & MODEL_CONTROL_SOFTRESET)
+  {
+    status &= ~(MODEL_CONTROL_TRANSFERSTS | MODEL_CONTROL_BURSTSTS | MODEL_CONTROL_PERINTFLG);
+  }
+  if(write & MODEL_CONTROL_HALT)
+  {
+    status &= ~MODEL_CONTROL_RUNSTS;
+  }
+  if(write & MODEL_CONTROL_RUN)
+  {
+    status |= MODEL_CONTROL_RUNSTS;
+  }
+  if(write & MODEL_CONTROL_PERINTCLR)
+  {
+    status &= ~MODEL_CONTROL_PERINTFLG;
+  }
+  if(write & MODEL_CONTROL_PERINTFRC)
+  {
+    //event not consumed yet is lost
+    status |= (status & MODEL_CONTROL_PERINTFLG) ? MODEL_CONTROL_OVRFLG : MODEL_CONTROL_PERINTFLG;
+  }
+  if(write & MODEL_CONTROL_ERRCLR)
+  {
+    status &= ~(MODEL_CONTROL_SYNCERR | MODEL_CONTROL_OVRFLG);
+  }
+
+  ch->CONTROL.all = status;
+}
+
+static uint32_t MODEL_TIMER_VALUE(uint16_t timer, uint32_t now)
+{
+  Model_Timer *t = &model.timer[timer];
+  uint32_t period = MODEL_TIMER_REGS(timer)->PRD.all;
+  uint32_t elapsed = now - t->start;
+
+  if(!t->running || (elapsed <= t->value))
+  {
+    return t->running ? (t->value - elapsed) : t->value;
+  }
+
+  //counter reached 0 and is reloaded by PRD
+  elapsed -= t->value + 1;
+  return (period == 0xFFFFFFFFUL) ? (period - elapsed) : (period - elapsed % (period + 1));
+}
+
+static void MODEL_TIMER_CONTROL(uint16_t timer, uint32_t now)
+{
+  volatile struct CPUTIMER_REGS *regs = MODEL_TIMER_REGS(timer);
+  Model_Timer *t = &model.timer[timer];
+  uint16_t tcr = regs->TCR.all;
+  uint32_t value = MODEL_TIMER_VALUE(timer, now);
+
+  if(tcr & MODEL_TCR_TRB)
+  {
+    value = regs->PRD.all;
+    regs->TCR.all = tcr & ~MODEL_TCR_TRB;
+  }
+
+  t->value = value;
+  t->start = now;
+  t->running = (tcr & MODEL_TCR_TSS) ? 0 : 1;
+  regs->TIM.all = value;
+}
+
+/**
+ * @brief Move model to cycle 'now'. Every word is finished at its own cycle and DMA reacts at once, so
+ * words are shifted back to back if DMA keeps FIFO not empty.
+ */
+static void MODEL_SYNC(uint32_t now)
+{
+  uint16_t i = 0;
+
+  for(i = 0; i < MODEL_SPI_NUMBER; i++)
+  {
+    Model_Spi *m = &model.spi[i];
+
+    while(m->shifting && ((int32_t)(now - m->doneAt) >= 0))
+    {
+      uint32_t at = m->doneAt;
+
+      MODEL_SPI_RECEIVE(i);
+      MODEL_DMA_RUN(at);
+      MODEL_SPI_START(i, at);
+    }
+  }
+
+  MODEL_DMA_RUN(now);
+
+  for(i = 0; i < MODEL_SPI_NUMBER; i++)
+  {
+    MODEL_SPI_STATUS(i);
+  }
+}
+
+/**
+ * @brief Registers read by instruction get value of model
+ */
+static void MODEL_BEFORE(const HostSim_Access *access, uint32_t now)
+{
+  uint16_t spi = MODEL_SPI_INDEX(access->address);
+  uint16_t i = 0;
+
+  if(spi < MODEL_SPI_NUMBER)
+  {
+    volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+    Model_Spi *m = &model.spi[spi];
+
+    if(!access->write && MODEL_IS(access, regs->SPIRXBUF) && MODEL_SPI_FIFO(regs) && (m->rxCount > 0))
+    {
+      regs->SPIRXBUF = m->rx[m->rxHead];
+    }
+  }
+
+  for(i = 0; i < MODEL_TIMER_NUMBER; i++)
+  {
+    volatile struct CPUTIMER_REGS *regs = MODEL_TIMER_REGS(i);
+
+    if(((uintptr_t)access->address & ~(uintptr_t)3) == (uintptr_t)&regs->TIM)
+    {
+      regs->TIM.all = MODEL_TIMER_VALUE(i, now);
+    }
+  }
+
+  if(MODEL_IS(access, PieCtrlRegs.PIEACK))
+  {
+    PieCtrlRegs.PIEACK.all = model.pieAck;
+  }
+
+  model.before = *(volatile uint16_t *)((uintptr_t)access->address & ~(uintptr_t)1);
+}
+
+/**
+ * @brief Effects of access: words written and read, bits cleared by write of 1, commands of DMA and timers
+ */
+static void MODEL_AFTER(const HostSim_Access *access, uint32_t now)
+{
+  uint16_t spi = MODEL_SPI_INDEX(access->address);
+  uint16_t i = 0;
+
+  if(spi < MODEL_SPI_NUMBER)
+  {
+    volatile struct SPI_REGS *regs = MODEL_SPI_REGS(spi);
+    Model_Spi *m = &model.spi[spi];
+    uint16_t write = *(volatile uint16_t *)((uintptr_t)access->address & ~(uintptr_t)1);
+    uint16_t keep = 0;
+
+    if(!access->write)
+    {
+      if(MODEL_IS(access, regs->SPIRXBUF))
+      {
+        MODEL_SPI_RX(spi);
+      }
+    }
+    else if(MODEL_IS(access, regs->SPITXBUF))
+    {
+      MODEL_SPI_TX(spi, write, now);
+    }
+    else if(MODEL_IS(access, regs->SPICCR))
+    {
+      if(!(write & MODEL_CCR_SPISWRESET))
+      {
+        m->shifting = 0;
+        m->txbufFull = 0;
+        regs->SPISTS.all = 0;
+      }
+    }
+    else if(MODEL_IS(access, regs->SPISTS))
+    {
+      regs->SPISTS.all = model.before & ~(write & MODEL_STS_OVERRUN);
+    }
+    else if(MODEL_IS(access, regs->SPIFFTX))
+    {
+      keep = (write & MODEL_FF_INTCLR) ? 0 : (model.before & MODEL_FF_INT);
+      if(!(write & MODEL_FF_RESET) || !(write & MODEL_FFTX_SPIRST))
+      {
+        m->txHead = 0;
+        m->txCount = 0;
+      }
+      regs->SPIFFTX.all = (write & ~(MODEL_FF_ST | MODEL_FF_INT | MODEL_FF_INTCLR)) | keep;
+    }
+    else if(MODEL_IS(access, regs->SPIFFRX))
+    {
+      keep = ((write & MODEL_FF_INTCLR) ? 0 : (model.before & MODEL_FF_INT)) |
+             ((write & MODEL_FFRX_OVFCLR) ? 0 : (model.before & MODEL_FFRX_OVF));
+      if(!(write & MODEL_FF_RESET))
+      {
+        m->rxHead = 0;
+        m->rxCount = 0;
+      }
+      regs->SPIFFRX.all = (write & ~(MODEL_FF_ST | MODEL_FF_INT | MODEL_FF_INTCLR | MODEL_FFRX_OVF | MODEL_FFRX_OVFCLR)) | keep;
+    }
+  }
+
+  if(!access->write)
+  {
+    return;
+  }
+
+  for(i = 0; i < MODEL_DMA_NUMBER; i++)
+  {
+    if(MODEL_IS(access, (&DmaRegs.CH1 + i)->CONTROL))
+    {
+      MODEL_DMA_CONTROL(i);
+    }
+  }
+
+  for(i = 0; i < MODEL_TIMER_NUMBER; i++)
+  {
+    if(MODEL_IS(access, MODEL_TIMER_REGS(i)->TCR))
+    {
+      MODEL_TIMER_CONTROL(i, now);
+    }
+  }
+
+  if(MODEL_IS(access, PieCtrlRegs.PIEACK))
+  {
+    model.pieAck &= ~PieCtrlRegs.PIEACK.all;
+    PieCtrlRegs.PIEACK.all = model.pieAck;
+  }
+}
+
+static void MODEL_HOOK(const HostSim_Access *access, uint16_t done, uint32_t now)
+{
+  if(!done)
+  {
+    MODEL_SYNC(now);
+    MODEL_BEFORE(access, now);
+  }
+  else
+  {
+    MODEL_AFTER(access, now);
+    MODEL_SYNC(now);
+  }
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+void HostModel_Start(void)
+{
+  uint16_t i = 0;
+
+  memset(&model, 0, sizeof(model));
+
+  //time of measurement starts from 0
+  for(i = 0; i < MODEL_TIMER_NUMBER; i++)
+  {
+    model.timer[i].running = (MODEL_TIMER_REGS(i)->TCR.all & MODEL_TCR_TSS) ? 0 : 1;
+    model.timer[i].value = MODEL_TIMER_REGS(i)->TIM.all;
+  }
+
+  HostSim_ModelStart(MODEL_HOOK);
+}
+
+void HostModel_Stop(void)
+{
+  HostSim_ModelStop();
+}
+
+void HostModel_Service(void)
+{
+  volatile PINT *vectors = (volatile PINT *)&PieVectTable;
+  uint16_t group = 0;
+  uint16_t pending = 0;
+  uint16_t bit = 0;
+  uint16_t ier = 0;
+
+  for(group = 1; group <= MODEL_PIE_GROUPS; group++)
+  {
+    uint16_t mask = 1U << (group - 1);
+
+    if(HostSim_Cpu.intm || !(IER & mask) || (model.pieAck & mask))
+    {
+      continue;
+    }
+
+    pending = *MODEL_PIEIER(group) & *MODEL_PIEIFR(group);
+    if(pending == 0)
+    {
+      continue;
+    }
+
+    for(bit = 0; !(pending & (1U << bit)); bit++)
+    {
+    }
+
+    //PIE blocks group until ISR writes PIEACK, CPU disables interrupts until return from ISR
+    *MODEL_PIEIFR(group) &= ~(1U << bit);
+    model.pieAck |= mask;
+    ier = IER;
+    HostSim_Cpu.intm = 1;
+
+    vectors[(bit < 8) ? (MODEL_PIE_VECT_LOW + 8 * (group - 1) + bit) : (MODEL_PIE_VECT_HIGH + 8 * (group - 1) + bit - 8)]();
+
+    IER = ier;
+    HostSim_Cpu.intm = 0;
+
+    //interrupts of higher priority are checked again
+    group = 0;
+  }
+}
+
+#endif /* HOST_SIM */
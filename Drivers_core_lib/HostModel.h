@@ -0,0 +1,59 @@
+/**
+ * @file HostModel.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of peripheral model for host simulation (HOST_SIM). RAM images of HostSim behave like
+ * hardware for peripherals used by SPI drivers:
+ *
+ *   SPI A/B/C  - master shifts words timed by SPIBRR, SPICHAR and LOSPCP, internal loopback (SPILBK), without
+ *                loopback SPISOMI is high. FIFOs of 16 words with status, levels, flags, overflow, interrupts
+ *                of group 6 and DMA requests. Without FIFO SPITXBUF, INT_FLAG, BUFFULL_FLAG and OVERRUN_FLAG.
+ *   DMA        - channels 1-6 triggered by SPITXDMA/SPIRXDMA selected at DMACHSRCSEL, other triggers are
+ *                events forced by PERINTFRC. Bursts and transfers with steps and wrap, 16 and 32-bit data,
+ *                one-shot and continuous mode with reload of shadow registers, channel interrupt at start or at
+ *                end of transfer, HALT/RUN/SOFTRESET, OVRFLG of event lost.
+ *   PIE        - PIEACK is cleared by write of 1, pending interrupts are dispatched by HostModel_Service().
+ *   CPU timers - TIM counts down by C28x cycles, TRB reloads PRD, TSS stops timer, prescaler is not modelled.
+ *
+ * Time of model is number of C28x cycles estimated by measurement, so model is used between
+ * HostSim_MeasureStart() and HostSim_MeasureStop(). DMA addresses have 32 bits, so buffs used by DMA must be
+ * static variables of application, like at target where they are at GS RAM. i.e:
+ *
+ *   HostModel_Start();
+ *   HostSim_MeasureStart();
+ *   spiTransfer(SPI_A, sendbuff, readbuff, 32);
+ *   while(spiBusy(SPI_A))
+ *   {
+ *     HostModel_Service();
+ *   }
+ *   HostSim_MeasureStop(&measure);
+ *   HostModel_Stop();
+ */
+
+#ifndef HOSTMODEL_H_
+#define HOSTMODEL_H_
+
+#ifdef HOST_SIM
+
+/**
+ * @brief Function used to start model. State of model is cleared, so it should be called after HostSim_Reset().
+ */
+void HostModel_Start(void);
+
+/**
+ * @brief Function used to stop model started by HostModel_Start()
+ */
+void HostModel_Stop(void);
+
+/**
+ * @brief Function used to dispatch pending PIE interrupts, like CPU do it between instructions. Interrupt
+ * is taken if PIEIFR and PIEIER bit is set, group is not blocked by PIEACK, group is enabled at IER and
+ * INTM is cleared by EINT. Should be called at wait loops of application.
+ */
+void HostModel_Service(void);
+
+#endif /* HOST_SIM */
+
+#endif /* HOSTMODEL_H_ */
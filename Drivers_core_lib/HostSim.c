@@ -0,0 +1,648 @@
+/**
+ * @file HostSim.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of host simulation backend. Whole file is compiled only with HOST_SIM define,
+ * at target build it is empty.
+ */
+
+#ifdef HOST_SIM
+
+#if defined(__x86_64__) && defined(__linux__)
+#define _GNU_SOURCE
+#define HOSTSIM_MEASURE_SUPPORTED
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include <string.h>
+#include "F2837xS_device.h"
+#include "HostSim.h"
+
+#define HOSTSIM_EFLAGS_TF       0x100     //x86 trap flag, single step
+#define HOSTSIM_PF_WRITE        0x2       //page fault error code, access was a write
+#define HOSTSIM_PENDING_PAGES   4         //pages opened by one instruction
+
+#define HOSTSIM_X86_OPSIZE      0x66      //operand size prefix, 16-bit access
+#define HOSTSIM_X86_REXW        0x08      //REX.W bit, 64-bit access
+
+#define HOSTSIM_REGFILE(regs)   { #regs, &regs, sizeof(regs) }
+
+//CPU core registers, at target they are __cregister
+volatile unsigned int IFR;
+volatile unsigned int IER;
+
+HostSim_CpuState HostSim_Cpu;
+
+/**
+ * @brief All of register files defined at F2837xS_GlobalVariableDefs.c
+ */
+static const HostSim_RegFile HOSTSIM_REG_FILES[] =
+{
+  HOSTSIM_REGFILE(AdcaRegs),
+  HOSTSIM_REGFILE(AdcbRegs),
+  HOSTSIM_REGFILE(AdccRegs),
+  HOSTSIM_REGFILE(AdcdRegs),
+  HOSTSIM_REGFILE(AdcaResultRegs),
+  HOSTSIM_REGFILE(AdcbResultRegs),
+  HOSTSIM_REGFILE(AdccResultRegs),
+  HOSTSIM_REGFILE(AdcdResultRegs),
+  HOSTSIM_REGFILE(AnalogSubsysRegs),
+  HOSTSIM_REGFILE(Cmpss1Regs),
+  HOSTSIM_REGFILE(Cmpss2Regs),
+  HOSTSIM_REGFILE(Cmpss3Regs),
+  HOSTSIM_REGFILE(Cmpss4Regs),
+  HOSTSIM_REGFILE(Cmpss5Regs),
+  HOSTSIM_REGFILE(Cmpss6Regs),
+  HOSTSIM_REGFILE(Cmpss7Regs),
+  HOSTSIM_REGFILE(Cmpss8Regs),
+  HOSTSIM_REGFILE(DacaRegs),
+  HOSTSIM_REGFILE(DacbRegs),
+  HOSTSIM_REGFILE(DaccRegs),
+  HOSTSIM_REGFILE(Cla1Regs),
+  HOSTSIM_REGFILE(Cla1SoftIntRegs),
+  HOSTSIM_REGFILE(ClkCfgRegs),
+  HOSTSIM_REGFILE(CpuSysRegs),
+  HOSTSIM_REGFILE(CpuTimer0Regs),
+  HOSTSIM_REGFILE(CpuTimer1Regs),
+  HOSTSIM_REGFILE(CpuTimer2Regs),
+  HOSTSIM_REGFILE(DcsmZ1Regs),
+  HOSTSIM_REGFILE(DcsmZ2Regs),
+  HOSTSIM_REGFILE(DcsmCommonRegs),
+  HOSTSIM_REGFILE(DmaRegs),
+  HOSTSIM_REGFILE(DmaClaSrcSelRegs),
+  HOSTSIM_REGFILE(DevCfgRegs),
+  HOSTSIM_REGFILE(ECap1Regs),
+  HOSTSIM_REGFILE(ECap2Regs),
+  HOSTSIM_REGFILE(ECap3Regs),
+  HOSTSIM_REGFILE(ECap4Regs),
+  HOSTSIM_REGFILE(ECap5Regs),
+  HOSTSIM_REGFILE(ECap6Regs),
+  HOSTSIM_REGFILE(Emif1Regs),
+  HOSTSIM_REGFILE(Emif2Regs),
+  HOSTSIM_REGFILE(EQep1Regs),
+  HOSTSIM_REGFILE(EQep2Regs),
+  HOSTSIM_REGFILE(EQep3Regs),
+  HOSTSIM_REGFILE(EPwm1Regs),
+  HOSTSIM_REGFILE(EPwm2Regs),
+  HOSTSIM_REGFILE(EPwm3Regs),
+  HOSTSIM_REGFILE(EPwm4Regs),
+  HOSTSIM_REGFILE(EPwm5Regs),
+  HOSTSIM_REGFILE(EPwm6Regs),
+  HOSTSIM_REGFILE(EPwm7Regs),
+  HOSTSIM_REGFILE(EPwm8Regs),
+  HOSTSIM_REGFILE(EPwm9Regs),
+  HOSTSIM_REGFILE(EPwm10Regs),
+  HOSTSIM_REGFILE(EPwm11Regs),
+  HOSTSIM_REGFILE(EPwm12Regs),
+  HOSTSIM_REGFILE(EPwmXbarRegs),
+  HOSTSIM_REGFILE(GpioCtrlRegs),
+  HOSTSIM_REGFILE(GpioDataRegs),
+  HOSTSIM_REGFILE(InputXbarRegs),
+  HOSTSIM_REGFILE(XbarRegs),
+  HOSTSIM_REGFILE(OutputXbarRegs),
+  HOSTSIM_REGFILE(I2caRegs),
+  HOSTSIM_REGFILE(I2cbRegs),
+  HOSTSIM_REGFILE(FlashPumpSemaphoreRegs),
+  HOSTSIM_REGFILE(McbspaRegs),
+  HOSTSIM_REGFILE(RomPrefetchRegs),
+  HOSTSIM_REGFILE(MemCfgRegs),
+  HOSTSIM_REGFILE(Emif1ConfigRegs),
+  HOSTSIM_REGFILE(Emif2ConfigRegs),
+  HOSTSIM_REGFILE(RomWaitStateRegs),
+  HOSTSIM_REGFILE(AccessProtectionRegs),
+  HOSTSIM_REGFILE(MemoryErrorRegs),
+  HOSTSIM_REGFILE(McbspbRegs),
+  HOSTSIM_REGFILE(NmiIntruptRegs),
+  HOSTSIM_REGFILE(PieCtrlRegs),
+  HOSTSIM_REGFILE(PieVectTable),
+  HOSTSIM_REGFILE(SciaRegs),
+  HOSTSIM_REGFILE(ScibRegs),
+  HOSTSIM_REGFILE(ScicRegs),
+  HOSTSIM_REGFILE(ScidRegs),
+  HOSTSIM_REGFILE(SpiaRegs),
+  HOSTSIM_REGFILE(SpibRegs),
+  HOSTSIM_REGFILE(SpicRegs),
+  HOSTSIM_REGFILE(Sdfm1Regs),
+  HOSTSIM_REGFILE(Sdfm2Regs),
+  HOSTSIM_REGFILE(SyncSocRegs),
+  HOSTSIM_REGFILE(UppRegs),
+  HOSTSIM_REGFILE(WdRegs),
+  HOSTSIM_REGFILE(XintRegs),
+  HOSTSIM_REGFILE(Flash0EccRegs),
+  HOSTSIM_REGFILE(Flash0CtrlRegs),
+  HOSTSIM_REGFILE(Flash1EccRegs),
+  HOSTSIM_REGFILE(Flash1CtrlRegs),
+};
+
+#define HOSTSIM_REG_FILES_NUMBER   (sizeof(HOSTSIM_REG_FILES) / sizeof(HOSTSIM_REG_FILES[0]))
+
+#ifdef HOSTSIM_MEASURE_SUPPORTED
+/**
+ * @brief State of measurement. It is thread local, so it never share a page with register files
+ * and signal handlers can use it while register pages are protected.
+ */
+typedef struct
+{
+  uint8_t *protStart;                             //first protected page
+  uint8_t *protEnd;                               //end of last protected page
+  uint8_t *pending[HOSTSIM_PENDING_PAGES];        //pages opened for single instruction
+  uint16_t pendingNumber;
+  uint16_t watchers;                              //number of active users of protection (measure, watch)
+  uint16_t stepping;                              //1 - measurement is running
+  uint16_t calibrated;                            //1 - overhead is measured
+  uint32_t overhead;                              //instructions of HostSim_MeasureStart/Stop itself
+  long pagesize;
+  HostSim_Measure measure;
+  HostSim_AccessHook hook;                        //hook of HostSim_WatchStart(), can be NULL
+  HostSim_ModelHook model;                        //hook of HostSim_ModelStart(), can be NULL
+  HostSim_Access access;                          //register access of current instruction
+  uint16_t accessPending;                         //1 - hook wait for end of instruction
+  uint16_t allOpen;                               //1 - all register files opened for model until end of instruction
+} HostSim_Trap;
+
+static __thread HostSim_Trap trap;
+#endif
+
+//********************************************CPU INSTRUCTIONS*****************************************************
+
+void HostSim_Eint(void)
+{
+  HostSim_Cpu.intm = 0;
+  HostSim_Cpu.eintCount++;
+}
+
+void HostSim_Dint(void)
+{
+  HostSim_Cpu.intm = 1;
+  HostSim_Cpu.dintCount++;
+}
+
+void HostSim_Eallow(void)
+{
+  HostSim_Cpu.eallow = 1;
+  HostSim_Cpu.eallowCount++;
+}
+
+void HostSim_Edis(void)
+{
+  HostSim_Cpu.eallow = 0;
+  HostSim_Cpu.edisCount++;
+}
+
+void HostSim_Estop0(void)
+{
+  HostSim_Cpu.estopCount++;
+}
+
+//********************************************INTERFACE*********************************************************
+
+void HostSim_Reset(void)
+{
+  uint16_t i = 0;
+
+  for(i = 0; i < HOSTSIM_REG_FILES_NUMBER; i++)
+  {
+    memset((void *)HOSTSIM_REG_FILES[i].base, 0, HOSTSIM_REG_FILES[i].size);
+  }
+
+  IFR = 0;
+  IER = 0;
+
+  memset(&HostSim_Cpu, 0, sizeof(HostSim_Cpu));
+  HostSim_Cpu.intm = 1;         //after reset interrupts are disabled
+}
+
+const HostSim_RegFile* HostSim_FindRegFile(const volatile void *address)
+{
+  const HostSim_RegFile *ret = NULL;
+  uint16_t i = 0;
+
+  for(i = 0; i < HOSTSIM_REG_FILES_NUMBER; i++)
+  {
+    const volatile uint8_t *base = (const volatile uint8_t *)HOSTSIM_REG_FILES[i].base;
+
+    if(((const volatile uint8_t *)address >= base) && ((const volatile uint8_t *)address < base + HOSTSIM_REG_FILES[i].size))
+    {
+      ret = &HOSTSIM_REG_FILES[i];
+      break;
+    }
+  }
+
+  return ret;
+}
+
+const HostSim_RegFile* HostSim_RegFiles(uint16_t *count)
+{
+  *count = HOSTSIM_REG_FILES_NUMBER;
+  return HOSTSIM_REG_FILES;
+}
+
+void HostSim_GpioUpdate(void)
+{
+  //each port have DAT, SET, CLEAR and TOGGLE register one by one
+  volatile uint32_t *port = (volatile uint32_t *)&GpioDataRegs;
+  uint16_t i = 0;
+
+  for(i = 0; i < sizeof(GpioDataRegs) / (4 * sizeof(uint32_t)); i++, port += 4)
+  {
+    port[0] |= port[1];         //GPxSET
+    port[0] &= ~port[2];        //GPxCLEAR
+    port[0] ^= port[3];         //GPxTOGGLE
+
+    port[1] = 0;
+    port[2] = 0;
+    port[3] = 0;
+  }
+}
+
+//********************************************MEASUREMENT*******************************************************
+
+#ifdef HOSTSIM_MEASURE_SUPPORTED
+
+/**
+ * @brief Raw system call. Signal handlers must not use PLT of libc, because .got.plt and .data of
+ * application can share a page with register files and it is protected.
+ */
+static long HOSTSIM_SYSCALL(long number, long arg1, long arg2, long arg3, long arg4)
+{
+  long ret;
+  register long r10 __asm__("r10") = arg4;
+
+  __asm__ volatile("syscall" : "=a"(ret) : "a"(number), "D"(arg1), "S"(arg2), "d"(arg3), "r"(r10) : "rcx", "r11", "memory");
+  return ret;
+}
+
+/**
+ * @brief C28x cycles of running measurement, the same model as HostSim_MeasureStop()
+ */
+static uint32_t HOSTSIM_NOW(void)
+{
+  return trap.measure.instructions * HOSTSIM_CYCLES_INSTRUCTION + trap.measure.regReads * HOSTSIM_CYCLES_REG_READ
+       + trap.measure.regWrites * HOSTSIM_CYCLES_REG_WRITE;
+}
+
+/**
+ * @brief Size of memory operand of x86 instruction. Only forms generated by gcc for register
+ * access are decoded (mov, movzx, movsx and ALU with memory operand), other are taken as 32-bit.
+ */
+static uint16_t HOSTSIM_ACCESS_SIZE(const uint8_t *code)
+{
+  uint16_t size16 = 0;
+  uint16_t size64 = 0;
+  uint16_t ret = 4;
+
+  //legacy prefixes
+  while((*code == HOSTSIM_X86_OPSIZE) || (*code == 0xF0) || (*code == 0xF2) || (*code == 0xF3) ||
+        (*code == 0x2E) || (*code == 0x3E) || (*code == 0x26) || (*code == 0x36) || (*code == 0x64) || (*code == 0x65))
+  {
+    if(*code == HOSTSIM_X86_OPSIZE)
+    {
+      size16 = 1;
+    }
+    code++;
+  }
+
+  //REX prefix
+  if((*code & 0xF0) == 0x40)
+  {
+    size64 = (*code & HOSTSIM_X86_REXW) ? 1 : 0;
+    code++;
+  }
+
+  if(code[0] == 0x0F)
+  {
+    if((code[1] == 0xB6) || (code[1] == 0xBE))
+    {
+      ret = 1;                                      //movzx/movsx from byte
+    }
+    else if((code[1] == 0xB7) || (code[1] == 0xBF))
+    {
+      ret = 2;                                      //movzx/movsx from word
+    }
+  }
+  else if(((code[0] < 0x40) && ((code[0] & 0x07) <= 0x02) && !(code[0] & 0x01)) ||
+          (code[0] == 0x80) || (code[0] == 0x84) || (code[0] == 0x86) || (code[0] == 0x88) ||
+          (code[0] == 0x8A) || (code[0] == 0xC6) || (code[0] == 0xF6) || (code[0] == 0xFE))
+  {
+    ret = 1;                                        //byte form of instruction
+  }
+  else if(size64)
+  {
+    ret = 8;
+  }
+  else if(size16)
+  {
+    ret = 2;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Page fault at protected register page. Count access, open the page and step one instruction.
+ */
+static void HOSTSIM_SEGV(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t *uc = (ucontext_t *)context;
+  uint8_t *address = (uint8_t *)info->si_addr;
+  uint8_t *page = NULL;
+  const HostSim_RegFile *regFile = NULL;
+  long pagesize = trap.pagesize;
+
+  (void)sig;
+
+  if((address < trap.protStart) || (address >= trap.protEnd) || (trap.pendingNumber >= HOSTSIM_PENDING_PAGES))
+  {
+    //real fault of application, restore default action and let instruction fault again
+    uint64_t dfl[4] = { 0, 0, 0, 0 };     //kernel struct sigaction with SIG_DFL
+
+    HOSTSIM_SYSCALL(SYS_rt_sigaction, SIGSEGV, (long)dfl, 0, sizeof(uint64_t));
+    return;
+  }
+
+  //other variables can share a page with register files, they are not counted
+  regFile = HostSim_FindRegFile(address);
+
+  if((regFile != NULL) && (trap.model != NULL))
+  {
+    //model can change any register, so all register files are opened until end of instruction
+    HOSTSIM_SYSCALL(SYS_mprotect, (long)trap.protStart, trap.protEnd - trap.protStart, PROT_READ | PROT_WRITE, 0);
+    trap.allOpen = 1;
+  }
+  else
+  {
+    page = (uint8_t *)((uintptr_t)address & ~(uintptr_t)(pagesize - 1));
+    HOSTSIM_SYSCALL(SYS_mprotect, (long)page, pagesize, PROT_READ | PROT_WRITE, 0);
+    trap.pending[trap.pendingNumber++] = page;
+  }
+
+  if(regFile != NULL)
+  {
+    uint16_t write = (uc->uc_mcontext.gregs[REG_ERR] & HOSTSIM_PF_WRITE) ? 1 : 0;
+
+    if(write)
+    {
+      trap.measure.regWrites++;
+    }
+    else
+    {
+      trap.measure.regReads++;
+    }
+
+    //one instruction access only one register, next fault of the same instruction is other page
+    if(((trap.hook != NULL) || (trap.model != NULL)) && (trap.accessPending == 0))
+    {
+      trap.access.regFile = regFile;
+      trap.access.regFileIndex = regFile - HOSTSIM_REG_FILES;
+      trap.access.offset = address - (uint8_t *)regFile->base;
+      trap.access.address = address;
+      trap.access.size = HOSTSIM_ACCESS_SIZE((const uint8_t *)uc->uc_mcontext.gregs[REG_RIP]);
+      trap.access.write = write;
+      trap.accessPending = 1;
+
+      if(trap.hook != NULL)
+      {
+        trap.hook(&trap.access, 0);
+      }
+      if(trap.model != NULL)
+      {
+        trap.model(&trap.access, 0, HOSTSIM_NOW());
+      }
+    }
+  }
+
+  uc->uc_mcontext.gregs[REG_EFL] |= HOSTSIM_EFLAGS_TF;
+}
+
+/**
+ * @brief Single step trap. Close pages opened by last instruction and count it.
+ */
+static void HOSTSIM_TRAP(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t *uc = (ucontext_t *)context;
+  long pagesize = trap.pagesize;
+
+  (void)sig;
+  (void)info;
+
+  if(trap.accessPending)
+  {
+    trap.accessPending = 0;
+    if(trap.hook != NULL)
+    {
+      trap.hook(&trap.access, 1);
+    }
+    if(trap.model != NULL)
+    {
+      trap.model(&trap.access, 1, HOSTSIM_NOW());
+    }
+  }
+
+  if(trap.allOpen)
+  {
+    HOSTSIM_SYSCALL(SYS_mprotect, (long)trap.protStart, trap.protEnd - trap.protStart, PROT_NONE, 0);
+    trap.allOpen = 0;
+    trap.pendingNumber = 0;
+  }
+
+  while(trap.pendingNumber > 0)
+  {
+    HOSTSIM_SYSCALL(SYS_mprotect, (long)trap.pending[--trap.pendingNumber], pagesize, PROT_NONE, 0);
+  }
+
+  if(trap.stepping)
+  {
+    trap.measure.instructions++;
+  }
+  else
+  {
+    uc->uc_mcontext.gregs[REG_EFL] &= ~HOSTSIM_EFLAGS_TF;
+  }
+}
+
+static void HOSTSIM_PROTECT(int prot)
+{
+  long pagesize = trap.pagesize;
+  uint8_t *start = NULL;
+  uint8_t *end = NULL;
+  uint16_t i = 0;
+
+  if(trap.protStart == NULL)
+  {
+    for(i = 0; i < HOSTSIM_REG_FILES_NUMBER; i++)
+    {
+      uint8_t *base = (uint8_t *)HOSTSIM_REG_FILES[i].base;
+
+      if((start == NULL) || (base < start))
+      {
+        start = base;
+      }
+      if((end == NULL) || (base + HOSTSIM_REG_FILES[i].size > end))
+      {
+        end = base + HOSTSIM_REG_FILES[i].size;
+      }
+    }
+
+    trap.protStart = (uint8_t *)((uintptr_t)start & ~(uintptr_t)(pagesize - 1));
+    trap.protEnd = (uint8_t *)(((uintptr_t)end + pagesize - 1) & ~(uintptr_t)(pagesize - 1));
+  }
+
+  mprotect(trap.protStart, trap.protEnd - trap.protStart, prot);
+}
+
+/**
+ * @brief Install signal handlers and protect register files. Calls can be nested.
+ */
+static void HOSTSIM_WATCH_ON(void)
+{
+  static struct sigaction segv;
+  static struct sigaction step;
+
+  if(segv.sa_sigaction == NULL)
+  {
+    trap.pagesize = sysconf(_SC_PAGESIZE);
+
+    segv.sa_sigaction = HOSTSIM_SEGV;
+    segv.sa_flags = SA_SIGINFO;
+    sigemptyset(&segv.sa_mask);
+    sigaction(SIGSEGV, &segv, NULL);
+
+    step.sa_sigaction = HOSTSIM_TRAP;
+    step.sa_flags = SA_SIGINFO;
+    sigemptyset(&step.sa_mask);
+    sigaction(SIGTRAP, &step, NULL);
+  }
+
+  if(trap.watchers++ == 0)
+  {
+    HOSTSIM_PROTECT(PROT_NONE);
+  }
+}
+
+static void HOSTSIM_WATCH_OFF(void)
+{
+  if((trap.watchers > 0) && (--trap.watchers == 0))
+  {
+    HOSTSIM_PROTECT(PROT_READ | PROT_WRITE);
+  }
+}
+
+static void HOSTSIM_STEP_ON(void)
+{
+  __asm__ volatile("pushfq; orq %0, (%%rsp); popfq" : : "i"(HOSTSIM_EFLAGS_TF) : "memory", "cc");
+}
+
+static void HOSTSIM_STEP_OFF(void)
+{
+  __asm__ volatile("pushfq; andq %0, (%%rsp); popfq" : : "i"(~HOSTSIM_EFLAGS_TF) : "memory", "cc");
+}
+
+static void HOSTSIM_START(void)
+{
+  HOSTSIM_WATCH_ON();
+
+  memset(&trap.measure, 0, sizeof(trap.measure));
+  trap.measure.eallow = HostSim_Cpu.eallowCount;
+
+  trap.stepping = 1;
+  HOSTSIM_STEP_ON();
+}
+
+static void HOSTSIM_STOP(HostSim_Measure *measure)
+{
+  HOSTSIM_STEP_OFF();
+  trap.stepping = 0;
+  HOSTSIM_WATCH_OFF();
+
+  *measure = trap.measure;
+  measure->eallow = HostSim_Cpu.eallowCount - measure->eallow;
+}
+
+void HostSim_MeasureStart(void)
+{
+  //first call measure cost of empty measurement, the same way as application do it
+  if(trap.calibrated == 0)
+  {
+    HostSim_Measure empty;
+
+    trap.calibrated = 1;
+    HostSim_MeasureStart();
+    HostSim_MeasureStop(&empty);
+    trap.overhead = empty.instructions;
+  }
+
+  HOSTSIM_START();
+}
+
+void HostSim_MeasureStop(HostSim_Measure *measure)
+{
+  HOSTSIM_STOP(measure);
+
+  measure->instructions = (measure->instructions > trap.overhead) ? (measure->instructions - trap.overhead) : 0;
+  measure->cycles = measure->instructions * HOSTSIM_CYCLES_INSTRUCTION
+                  + measure->regReads * HOSTSIM_CYCLES_REG_READ
+                  + measure->regWrites * HOSTSIM_CYCLES_REG_WRITE;
+}
+
+void HostSim_WatchStart(HostSim_AccessHook hook)
+{
+  trap.hook = hook;
+  trap.accessPending = 0;
+  HOSTSIM_WATCH_ON();
+}
+
+void HostSim_WatchStop(void)
+{
+  HOSTSIM_WATCH_OFF();
+  trap.hook = NULL;
+}
+
+void HostSim_ModelStart(HostSim_ModelHook hook)
+{
+  trap.model = hook;
+  trap.accessPending = 0;
+  HOSTSIM_WATCH_ON();
+}
+
+void HostSim_ModelStop(void)
+{
+  HOSTSIM_WATCH_OFF();
+  trap.model = NULL;
+}
+
+#else
+
+void HostSim_MeasureStart(void)
+{
+}
+
+void HostSim_MeasureStop(HostSim_Measure *measure)
+{
+  memset(measure, 0, sizeof(*measure));
+}
+
+void HostSim_WatchStart(HostSim_AccessHook hook)
+{
+}
+
+void HostSim_WatchStop(void)
+{
+}
+
+void HostSim_ModelStart(HostSim_ModelHook hook)
+{
+}
+
+void HostSim_ModelStop(void)
+{
+}
+
+#endif /* HOSTSIM_MEASURE_SUPPORTED */
+
+#endif /* HOST_SIM */
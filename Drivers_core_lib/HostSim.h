@@ -0,0 +1,173 @@
+/**
+ * @file HostSim.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Host simulation backend of driver library. Used only when library is build with HOST_SIM define
+ * by gcc at Linux, i.e:
+ *
+ *   gcc -DHOST_SIM -I. -Iinclude DriverGPIO.c DriverDMA.c DriverSPI.c F2837xS_GlobalVariableDefs.c HostSim.c app.c
+ *
+ * At this mode every peripheral register struct (AdcaRegs, SpiaRegs, GpioCtrlRegs etc.) from
+ * F2837xS_GlobalVariableDefs.c is a RAM image, EALLOW/EDIS/EINT/DINT are function calls which track
+ * state of CPU and IFR/IER are normal variables.
+ */
+
+#ifndef HOSTSIM_H_
+#define HOSTSIM_H_
+
+#ifdef HOST_SIM
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Description of one simulated register file
+ */
+typedef struct
+{
+  const char *name;           //name of global variable, i.e "SpiaRegs"
+  volatile void *base;        //address of RAM image
+  size_t size;                //size of RAM image in bytes
+} HostSim_RegFile;
+
+/**
+ * @brief State of simulated CPU
+ */
+typedef struct
+{
+  uint16_t eallow;            //1 - protected registers are writable (EALLOW), 0 - after EDIS
+  uint16_t intm;              //1 - global interrupts disabled (DINT), 0 - enabled (EINT)
+  uint32_t eallowCount;       //number of EALLOW executed
+  uint32_t edisCount;         //number of EDIS executed
+  uint32_t eintCount;         //number of EINT executed
+  uint32_t dintCount;         //number of DINT executed
+  uint32_t estopCount;        //number of ESTOP0 executed
+} HostSim_CpuState;
+
+/**
+ * @brief Result of measurement of code between HostSim_MeasureStart() and HostSim_MeasureStop()
+ */
+typedef struct
+{
+  uint32_t instructions;      //number of host instructions executed
+  uint32_t regReads;          //number of instructions which read register file
+  uint32_t regWrites;         //number of instructions which write register file (read-modify-write is a write)
+  uint32_t eallow;            //number of EALLOW executed
+  uint32_t cycles;            //estimated number of C28x cycles, see HOSTSIM_CYCLES_*
+} HostSim_Measure;
+
+/**
+ * @brief One access of instruction to register file, passed to HostSim_AccessHook
+ */
+typedef struct
+{
+  const HostSim_RegFile *regFile;   //register file which is accessed
+  uint16_t regFileIndex;            //index of register file at HostSim_RegFiles() table
+  uint16_t offset;                  //offset of access in bytes from begin of register file
+  volatile void *address;           //address of access
+  uint16_t size;                    //size of access in bytes: 1, 2, 4 or 8
+  uint16_t write;                   //1 - instruction write register, 0 - instruction read register
+} HostSim_Access;
+
+/**
+ * @brief Hook called from signal handler before (done = 0) and after (done = 1) instruction which access
+ * register file. Register can be read and written by hook at both calls. Hook must not use libc and must
+ * keep its data at stack, heap or thread local variables, never at global variables.
+ */
+typedef void (*HostSim_AccessHook)(const HostSim_Access *access, uint16_t done);
+
+/**
+ * @brief Hook of peripheral model, called like HostSim_AccessHook. All register files are writable during
+ * both calls, so model can change any register. The same rules as for HostSim_AccessHook are used.
+ *
+ * @param uint32_t now - C28x cycles estimated by running measurement, time does not move without it
+ */
+typedef void (*HostSim_ModelHook)(const HostSim_Access *access, uint16_t done, uint32_t now);
+
+/**
+ * @brief Model of C28x cycles used by HostSim_MeasureStop(). One host instruction is count as one C28x
+ * instruction, every access to peripheral frame add wait states.
+ */
+#define HOSTSIM_CYCLES_INSTRUCTION      1     //cycles of one instruction
+#define HOSTSIM_CYCLES_REG_READ         2     //wait states of read from peripheral frame
+#define HOSTSIM_CYCLES_REG_WRITE        0     //wait states of write to peripheral frame
+
+/**
+ * @brief State of simulated CPU, can be read and clear by application
+ */
+extern HostSim_CpuState HostSim_Cpu;
+
+/**
+ * @brief Function used to clear all register files, IFR, IER and CPU state. CPU start with INTM set
+ * and EALLOW disabled, like after reset.
+ */
+void HostSim_Reset(void);
+
+/**
+ * @brief Function used to find register file which contain specific address
+ *
+ * @param const volatile void *address - address inside RAM image
+ *
+ * @return Pointer to description of register file or NULL if address is not a register
+ */
+const HostSim_RegFile* HostSim_FindRegFile(const volatile void *address);
+
+/**
+ * @brief Function used to get table of all simulated register files
+ *
+ * @param uint16_t *count - number of elements in table
+ *
+ * @return Pointer to first element of table
+ */
+const HostSim_RegFile* HostSim_RegFiles(uint16_t *count);
+
+/**
+ * @brief Function used to emulate GPIO data logic. Write-only GPxSET, GPxCLEAR and GPxTOGGLE latched
+ * at RAM image are applied to GPxDAT and cleared, like at hardware.
+ */
+void HostSim_GpioUpdate(void);
+
+/**
+ * @brief Function used to start measurement. Every instruction is single stepped and every page of
+ * register files is protected, so only x86_64 Linux host is supported. At other host measurement is zero.
+ */
+void HostSim_MeasureStart(void);
+
+/**
+ * @brief Function used to stop measurement started by HostSim_MeasureStart()
+ *
+ * @param HostSim_Measure *measure - pointer to struct where result is written
+ */
+void HostSim_MeasureStop(HostSim_Measure *measure);
+
+/**
+ * @brief Function used to start watching of register files. Hook is called at every access to register
+ * files until HostSim_WatchStop(). Can be used together with measurement.
+ *
+ * @param HostSim_AccessHook hook - function called at every access
+ */
+void HostSim_WatchStart(HostSim_AccessHook hook);
+
+/**
+ * @brief Function used to stop watching of register files started by HostSim_WatchStart()
+ */
+void HostSim_WatchStop(void);
+
+/**
+ * @brief Function used to start peripheral model, i.e HostModel.c. Hook is called at every access to register
+ * files until HostSim_ModelStop(), together with hook of HostSim_WatchStart().
+ *
+ * @param HostSim_ModelHook hook - function called at every access
+ */
+void HostSim_ModelStart(HostSim_ModelHook hook);
+
+/**
+ * @brief Function used to stop peripheral model started by HostSim_ModelStart()
+ */
+void HostSim_ModelStop(void);
+
+#endif /* HOST_SIM */
+
+#endif /* HOSTSIM_H_ */
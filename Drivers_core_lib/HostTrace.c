@@ -0,0 +1,375 @@
+/**
+ * @file HostTrace.c
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Source file of register access trace recorder. Whole file is compiled only with HOST_SIM define.
+ * Hooks are called from signal handler of HostSim, so they do not use libc and keep state thread local.
+ */
+
+#ifdef HOST_SIM
+
+#include "HostSim.h"
+#include "HostTrace.h"
+
+#define TRACE_FLAG_WRITE      0x01
+#define TRACE_SIZE_SHIFT      1
+#define TRACE_SIZE_MASK       0x06
+
+/**
+ * @brief One decoded record of stream
+ */
+typedef struct
+{
+  uint16_t write;
+  uint16_t size;
+  uint16_t regFileIndex;
+  uint16_t offset;
+  uint64_t value;
+} HostTrace_Record;
+
+/**
+ * @brief State of recorder and replay
+ */
+typedef struct
+{
+  uint8_t *stream;              //recording
+  uint32_t capacity;
+  uint32_t length;
+  HostTrace_Stats stats;
+  HostTrace_Record last;        //previous access, for statistics
+  uint16_t lastValid;
+  uint64_t before;              //value of register before write
+
+  const uint8_t *replay;        //replay
+  uint32_t replayLength;
+  uint32_t position;
+  HostTrace_Replay result;
+} HostTrace_State;
+
+static __thread HostTrace_State trace;
+
+//******************************************************STATIC FUNCTION**************************************************
+
+static uint16_t TRACE_SIZE_CODE(uint16_t size)
+{
+  uint16_t code = 0;
+
+  while((1U << code) < size)
+  {
+    code++;
+  }
+
+  return code;
+}
+
+static uint64_t TRACE_READ(volatile void *address, uint16_t size)
+{
+  uint64_t value = 0;
+
+  switch(size)
+  {
+    case 1:  value = *(volatile uint8_t *)address;   break;
+    case 2:  value = *(volatile uint16_t *)address;  break;
+    case 4:  value = *(volatile uint32_t *)address;  break;
+    default: value = *(volatile uint64_t *)address;  break;
+  }
+
+  return value;
+}
+
+static void TRACE_WRITE(volatile void *address, uint16_t size, uint64_t value)
+{
+  switch(size)
+  {
+    case 1:  *(volatile uint8_t *)address = (uint8_t)value;    break;
+    case 2:  *(volatile uint16_t *)address = (uint16_t)value;  break;
+    case 4:  *(volatile uint32_t *)address = (uint32_t)value;  break;
+    default: *(volatile uint64_t *)address = value;            break;
+  }
+}
+
+static void TRACE_PUT(const HostTrace_Record *record)
+{
+  uint16_t i = 0;
+
+  if(trace.length + 4 + record->size > trace.capacity)
+  {
+    trace.stats.dropped++;
+    return;
+  }
+
+  trace.stream[trace.length++] = (uint8_t)((record->write ? TRACE_FLAG_WRITE : 0) | (TRACE_SIZE_CODE(record->size) << TRACE_SIZE_SHIFT));
+  trace.stream[trace.length++] = (uint8_t)record->regFileIndex;
+  trace.stream[trace.length++] = (uint8_t)(record->offset & 0xFF);
+  trace.stream[trace.length++] = (uint8_t)(record->offset >> 8);
+
+  for(i = 0; i < record->size; i++)
+  {
+    trace.stream[trace.length++] = (uint8_t)(record->value >> (8 * i));
+  }
+}
+
+/**
+ * @brief Decode record at position of stream
+ *
+ * @return Size of record in bytes, 0 if stream is finished or broken
+ */
+static uint32_t TRACE_GET(const uint8_t *stream, uint32_t length, uint32_t position, HostTrace_Record *record)
+{
+  uint32_t ret = 0;
+  uint16_t i = 0;
+
+  if(position + 4 <= length)
+  {
+    record->write = (stream[position] & TRACE_FLAG_WRITE) ? 1 : 0;
+    record->size = 1U << ((stream[position] & TRACE_SIZE_MASK) >> TRACE_SIZE_SHIFT);
+    record->regFileIndex = stream[position + 1];
+    record->offset = (uint16_t)(stream[position + 2] | (stream[position + 3] << 8));
+    record->value = 0;
+
+    if(position + 4 + record->size <= length)
+    {
+      for(i = 0; i < record->size; i++)
+      {
+        record->value |= (uint64_t)stream[position + 4 + i] << (8 * i);
+      }
+      ret = 4 + record->size;
+    }
+  }
+
+  return ret;
+}
+
+static void TRACE_FROM_ACCESS(const HostSim_Access *access, HostTrace_Record *record)
+{
+  record->write = access->write;
+  record->size = access->size;
+  record->regFileIndex = access->regFileIndex;
+  record->offset = access->offset;
+  record->value = TRACE_READ(access->address, access->size);
+}
+
+static uint16_t TRACE_SAME_REGISTER(const HostTrace_Record *a, const HostTrace_Record *b)
+{
+  return (a->regFileIndex == b->regFileIndex) && (a->offset == b->offset) && (a->size == b->size);
+}
+
+static void TRACE_RECORD_HOOK(const HostSim_Access *access, uint16_t done)
+{
+  HostTrace_Record record;
+
+  if(access->write == 0)
+  {
+    //value which is read by instruction
+    if(done == 0)
+    {
+      TRACE_FROM_ACCESS(access, &record);
+
+      if(trace.lastValid && (trace.last.write == 0) && TRACE_SAME_REGISTER(&trace.last, &record))
+      {
+        trace.stats.repeatedReads++;
+      }
+
+      trace.stats.reads++;
+      TRACE_PUT(&record);
+      trace.last = record;
+      trace.lastValid = 1;
+    }
+  }
+  else
+  {
+    if(done == 0)
+    {
+      trace.before = TRACE_READ(access->address, access->size);
+    }
+    else
+    {
+      //value which is written by instruction
+      TRACE_FROM_ACCESS(access, &record);
+
+      if(record.value == trace.before)
+      {
+        trace.stats.redundantWrites++;
+      }
+
+      trace.stats.writes++;
+      TRACE_PUT(&record);
+      trace.last = record;
+      trace.lastValid = 1;
+    }
+  }
+}
+
+static void TRACE_REPLAY_HOOK(const HostSim_Access *access, uint16_t done)
+{
+  HostTrace_Record expected;
+  HostTrace_Record actual;
+  uint32_t size = 0;
+
+  //read is injected before instruction, write is checked after instruction
+  if((access->write == 0) != (done == 0))
+  {
+    return;
+  }
+
+  size = TRACE_GET(trace.replay, trace.replayLength, trace.position, &expected);
+  if(size == 0)
+  {
+    trace.result.diverged++;
+    return;
+  }
+  trace.position += size;
+
+  TRACE_FROM_ACCESS(access, &actual);
+
+  if((expected.write != actual.write) || !TRACE_SAME_REGISTER(&expected, &actual))
+  {
+    trace.result.diverged++;
+  }
+  else if(access->write == 0)
+  {
+    TRACE_WRITE(access->address, access->size, expected.value);
+    trace.result.matched++;
+  }
+  else if(expected.value != actual.value)
+  {
+    trace.result.valueMismatch++;
+  }
+  else
+  {
+    trace.result.matched++;
+  }
+}
+
+static err_trace TRACE_CHECK_HEADER(const uint8_t *stream, uint32_t length)
+{
+  err_trace ret = E_TRACE_OK;
+  uint16_t files = 0;
+
+  HostSim_RegFiles(&files);
+
+  if((stream == NULL) || (length < HOSTTRACE_HEADER_SIZE))
+  {
+    ret = E_TRACE_INVALID_PARAM;
+  }
+  else if((stream[0] != 'R') || (stream[1] != 'T') || (stream[2] != 'R') || (stream[3] != 'C') ||
+          ((stream[4] | (stream[5] << 8)) != HOSTTRACE_VERSION) || ((stream[6] | (stream[7] << 8)) != files))
+  {
+    ret = E_TRACE_INVALID_STREAM;
+  }
+
+  return ret;
+}
+
+//******************************************************INTERFACE FUNCTION************************************************
+
+err_trace HostTrace_RecordStart(uint8_t *stream, uint32_t capacity)
+{
+  err_trace ret = E_TRACE_OK;
+  uint16_t files = 0;
+
+  if((stream == NULL) || (capacity < HOSTTRACE_HEADER_SIZE))
+  {
+    ret = E_TRACE_INVALID_PARAM;
+  }
+  else
+  {
+    HostSim_RegFiles(&files);
+
+    stream[0] = 'R';
+    stream[1] = 'T';
+    stream[2] = 'R';
+    stream[3] = 'C';
+    stream[4] = (uint8_t)(HOSTTRACE_VERSION & 0xFF);
+    stream[5] = (uint8_t)(HOSTTRACE_VERSION >> 8);
+    stream[6] = (uint8_t)(files & 0xFF);
+    stream[7] = (uint8_t)(files >> 8);
+
+    trace.stream = stream;
+    trace.capacity = capacity;
+    trace.length = HOSTTRACE_HEADER_SIZE;
+    trace.lastValid = 0;
+    trace.stats = (HostTrace_Stats){ 0 };
+
+    HostSim_WatchStart(TRACE_RECORD_HOOK);
+  }
+
+  return ret;
+}
+
+uint32_t HostTrace_RecordStop(HostTrace_Stats *stats)
+{
+  HostSim_WatchStop();
+
+  if(stats != NULL)
+  {
+    *stats = trace.stats;
+  }
+
+  return trace.length;
+}
+
+err_trace HostTrace_ReplayStart(const uint8_t *stream, uint32_t length)
+{
+  err_trace ret = TRACE_CHECK_HEADER(stream, length);
+
+  if(ret == E_TRACE_OK)
+  {
+    trace.replay = stream;
+    trace.replayLength = length;
+    trace.position = HOSTTRACE_HEADER_SIZE;
+    trace.result = (HostTrace_Replay){ 0 };
+
+    HostSim_WatchStart(TRACE_REPLAY_HOOK);
+  }
+
+  return ret;
+}
+
+void HostTrace_ReplayStop(HostTrace_Replay *result)
+{
+  HostTrace_Record record;
+  uint32_t size = 0;
+
+  HostSim_WatchStop();
+
+  //count not used records
+  while((size = TRACE_GET(trace.replay, trace.replayLength, trace.position, &record)) != 0)
+  {
+    trace.position += size;
+    trace.result.remaining++;
+  }
+
+  *result = trace.result;
+}
+
+err_trace HostTrace_Print(FILE *file, const uint8_t *stream, uint32_t length)
+{
+  err_trace ret = TRACE_CHECK_HEADER(stream, length);
+  HostTrace_Record record;
+  const HostSim_RegFile *files = NULL;
+  uint16_t filesNumber = 0;
+  uint32_t position = HOSTTRACE_HEADER_SIZE;
+  uint32_t size = 0;
+
+  if(ret == E_TRACE_OK)
+  {
+    files = HostSim_RegFiles(&filesNumber);
+
+    while((size = TRACE_GET(stream, length, position, &record)) != 0)
+    {
+      position += size;
+
+      //offset is printed in 16-bit words like at C28x memory map
+      fprintf(file, "%c %s+0x%04X %u 0x%0*llX\n", record.write ? 'W' : 'R',
+              (record.regFileIndex < filesNumber) ? files[record.regFileIndex].name : "?",
+              record.offset / 2, (unsigned)record.size, 2 * record.size, (unsigned long long)record.value);
+    }
+  }
+
+  return ret;
+}
+
+#endif /* HOST_SIM */
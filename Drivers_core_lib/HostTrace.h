@@ -0,0 +1,111 @@
+/**
+ * @file HostTrace.h
+ *
+ * @Created on: 16 paz 2026
+ * @Author: KamilM
+ *
+ * @brief Header file of register access trace recorder for host simulation (HOST_SIM). Every read and
+ * write of peripheral register files (AdcaRegs, SpiaRegs, GpioCtrlRegs, PieCtrlRegs etc.) is recorded
+ * as compact binary stream. Stream can be replayed against the drivers: recorded reads are injected
+ * to registers and writes are compared with recorded one.
+ *
+ * Format of stream (little endian):
+ *   header - "RTRC", uint16_t version, uint16_t number of register files
+ *   record - uint8_t flags (bit0 - write, bit1..2 - log2 of size), uint8_t index of register file,
+ *            uint16_t offset in bytes at register file, value of 1, 2, 4 or 8 bytes
+ */
+
+#ifndef HOSTTRACE_H_
+#define HOSTTRACE_H_
+
+#ifdef HOST_SIM
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef int err_trace;
+
+/**
+ * @brief Numeric representation of trace error
+ */
+#define E_TRACE_OK                 0     //Operation successful
+#define E_TRACE_INVALID_PARAM     -1     //Invalid parameters
+#define E_TRACE_INVALID_STREAM    -2     //Stream is not a trace or is recorded with other register files
+
+#define HOSTTRACE_VERSION          1
+#define HOSTTRACE_HEADER_SIZE      8
+#define HOSTTRACE_RECORD_MAX       12    //maximal size of one record in bytes
+
+/**
+ * @brief Statistics of recording
+ */
+typedef struct
+{
+  uint32_t reads;               //number of register reads
+  uint32_t writes;              //number of register writes
+  uint32_t redundantWrites;     //writes which do not change value of register
+  uint32_t repeatedReads;       //reads of register which was read by previous access
+  uint32_t dropped;             //records which do not fit at stream
+} HostTrace_Stats;
+
+/**
+ * @brief Result of replay
+ */
+typedef struct
+{
+  uint32_t matched;             //accesses equal to stream
+  uint32_t valueMismatch;       //writes to the same register with other value
+  uint32_t diverged;            //accesses to other register or access type than stream
+  uint32_t remaining;           //records of stream which are not used
+} HostTrace_Replay;
+
+/**
+ * @brief Function used to start recording of register accesses
+ *
+ * @param uint8_t *stream     - buffer for stream, must be at heap or stack (see HostSim_AccessHook)
+ * @param uint32_t capacity   - size of buffer in bytes
+ *
+ * @return Status of operation
+ */
+err_trace HostTrace_RecordStart(uint8_t *stream, uint32_t capacity);
+
+/**
+ * @brief Function used to stop recording
+ *
+ * @param HostTrace_Stats *stats - statistics of recording, can be NULL
+ *
+ * @return Length of recorded stream in bytes
+ */
+uint32_t HostTrace_RecordStop(HostTrace_Stats *stats);
+
+/**
+ * @brief Function used to start replay of recorded stream against the drivers
+ *
+ * @param const uint8_t *stream   - recorded stream, must be at heap or stack (see HostSim_AccessHook)
+ * @param uint32_t length         - length of stream in bytes
+ *
+ * @return Status of operation
+ */
+err_trace HostTrace_ReplayStart(const uint8_t *stream, uint32_t length);
+
+/**
+ * @brief Function used to stop replay
+ *
+ * @param HostTrace_Replay *result - result of replay
+ */
+void HostTrace_ReplayStop(HostTrace_Replay *result);
+
+/**
+ * @brief Function used to print stream as text, one access per line. Output of two streams can be compared by diff.
+ *
+ * @param FILE *file              - output file
+ * @param const uint8_t *stream   - recorded stream
+ * @param uint32_t length         - length of stream in bytes
+ *
+ * @return Status of operation
+ */
+err_trace HostTrace_Print(FILE *file, const uint8_t *stream, uint32_t length);
+
+#endif /* HOST_SIM */
+
+#endif /* HOSTTRACE_H_ */
@@ -57,6 +57,7 @@ extern "C" {
 //
 // Common CPU Definitions:
 //
+#ifndef HOST_SIM
 extern __cregister volatile unsigned int IFR;
 extern __cregister volatile unsigned int IER;
 
@@ -71,6 +72,39 @@ extern __cregister volatile unsigned int IER;
 #define  EDIS   __asm(" EDIS")
 #endif
 #define  ESTOP0 __asm(" ESTOP0")
+#else
+//
+// Host simulation build (HOST_SIM): peripheral register files are plain RAM
+// images, C28x keywords are removed and the CPU status bits are tracked by
+// HostSim.c. See HostSim.h.
+//
+#define  __cregister
+#define  interrupt
+#define  __interrupt
+#define  asm(x)
+#define  __asm(x)
+
+extern volatile unsigned int IFR;
+extern volatile unsigned int IER;
+
+extern void HostSim_Eint(void);
+extern void HostSim_Dint(void);
+extern void HostSim_Eallow(void);
+extern void HostSim_Edis(void);
+extern void HostSim_Estop0(void);
+
+#define  EINT   HostSim_Eint()
+#define  DINT   HostSim_Dint()
+#define  ERTM
+#define  DRTM
+#ifndef  EALLOW
+#define  EALLOW HostSim_Eallow()
+#endif
+#ifndef  EDIS
+#define  EDIS   HostSim_Edis()
+#endif
+#define  ESTOP0 HostSim_Estop0()
+#endif // HOST_SIM
 
 #define M_INT1  0x0001
 #define M_INT2  0x0002
@@ -261,6 +295,7 @@ typedef _Bool status_t;
 //
 #ifndef DSP28_DATA_TYPES
 #define DSP28_DATA_TYPES
+#ifndef HOST_SIM
 typedef int             	int16;
 typedef long            	int32;
 typedef long long			int64;
@@ -269,6 +304,19 @@ typedef unsigned long   	Uint32;
 typedef unsigned long long	Uint64;
 typedef float           	float32;
 typedef long double     	float64;
+#else
+//
+// Keep register widths of the C28x on the host, 16-bit word maps to 2 bytes
+//
+typedef int16_t         	int16;
+typedef int32_t         	int32;
+typedef int64_t         	int64;
+typedef uint16_t        	Uint16;
+typedef uint32_t        	Uint32;
+typedef uint64_t        	Uint64;
+typedef float           	float32;
+typedef double          	float64;
+#endif
 #endif
 
 //
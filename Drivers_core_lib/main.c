@@ -4,20 +4,26 @@
 
 #include "F2837xS_device.h"
 #include "DriverGPIO.h"
+#include "DriverADC.h"
 #include "F2837xS_pievect.h"
 
-void delay()
+GPIOCfg_Type pin1;
+GPIOPin_Type led;                 //handle of pin toogled at timer0 ISR
+interrupt void timer0(void);
+void adc0(ADCType adc, ADC_IntType irq);
+
+static const ADC_Channel adcChannels[] =
 {
-  int a = 0;
-  for (a; a < 30000; a++)
-  {
-    asm(" NOP");
-  }
-}
+  { ADC_A, 0, 0, ADC_TRIGGER_TINT(0), 24, ADC_INT1 },     //ADC_A0 triggered by timer0, end of SOC0 sets INT1
+};
 
-GPIOCfg_Type *pin1;
-interrupt void timer0(void);
-interrupt void adc0(void);
+//main does not call InitSysCtrl(), so CPU runs from INTOSC2 10 MHz after reset
+static const ADC_Cfg adcConfig =
+{
+  adcChannels, 1, ADC_DIV_1_0,                            //ADCCLK 10 MHz at SYSCLK 10 MHz
+  &CpuTimer2Regs.TIM.all, ADC_SETTLE_CYCLES(10),          //free running timer2
+  adc0
+};
 
 volatile uint32_t count;
 
@@ -34,43 +40,40 @@ void configtimer0(void)
   CpuTimer0Regs.TCR.bit.TSS = 0;    //start timer
 }
 
+void configtimer2(void)
+{
+  CpuTimer2Regs.TCR.bit.TSS = 1;   //stop timer
+
+  CpuTimer2Regs.PRD.all = 0xFFFFFFFF;  //free running clock of drivers
+  CpuTimer2Regs.TPR.bit.PSC = 0;   //prescaler by 1
+  CpuTimer2Regs.TCR.bit.TRB = 1;   //reload
+  CpuTimer2Regs.TCR.bit.TSS = 0;    //start timer
+}
+
 void initGpio()
 {
-  pin1->direction = DIR_Output;
-  pin1->pinFunction = MUX_0;
-  pin1->type = ODR_NormalOutput;
-  pin1->pin = 12;
-  pin1->pull = PUD_Enable;
-  pin1->core = CORE_CPU1;
-  pin1->invert = INV_InvertDisable;
-  pin1->samplingPeriod = 0;
-  pin1->samplingQualification = QSEL_SYNC;
-
-  pinGPIOCfg(pin1);
+  pin1.direction = DIR_Output;
+  pin1.pinFunction = MUX_0;
+  pin1.type = ODR_NormalOutput;
+  pin1.pin = 12;
+  pin1.pull = PUD_Enable;
+  pin1.core = CORE_CPU1;
+  pin1.invert = INV_InvertDisable;
+  pin1.samplingPeriod = 0;
+  pin1.samplingQualification = QSEL_SYNC;
+
+  pinGPIOCfg(&pin1);
+  pinGPIOHandle(pin1.pin, &led);
 
 }
 
 void initADC()
 {
-  EALLOW;
-  CpuSysRegs.PCLKCR13.bit.ADC_A = 1;
-  delay();
-  AdcaRegs.ADCCTL2.bit.PRESCALE = 6;
-  AdcaRegs.ADCSOC0CTL.bit.CHSEL = 0;      //ADC_A0
-  AdcaRegs.ADCSOC0CTL.bit.ACQPS = 24;     //acquiisition prescale
-  AdcaRegs.ADCSOC0CTL.bit.TRIGSEL = 1;    //trig from TIM0
-  AdcaRegs.ADCCTL1.bit.INTPULSEPOS = 1;   //set pulse to late
-  AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = 0; //end of SOC0 will set INT1 flag
-  AdcaRegs.ADCINTSEL1N2.bit.INT1E = 1;   //enable INT1 flag
-  AdcaRegs.ADCCTL1.bit.ADCPWDNZ = 1;      //power up
-  PieCtrlRegs.PIEIER1.bit.INTx1 = 1;      //interrupt from int1
-  AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; //make sure INT1 flag is cleared
-  delay();
-  EDIS;
-
+  adcCfg(&adcConfig);               //ADC settles during the rest of init, triggers are armed by adcReady()
 }
 
 
+#ifndef HOST_SIM
 int main(void)
 {
   IER = 0x0000;
@@ -79,12 +82,16 @@ int main(void)
   InitPieVectTable();
   EALLOW;
   PieVectTable.TIMER0_INT = &timer0;
-  PieVectTable.ADCA1_INT = &adc0;
   EDIS;
 
+  configtimer2();
+  initADC();
   initGpio();
   configtimer0();
-  initADC();
+
+  while (adcReady() == E_ADC_BUSY)
+  {
+  }
 
   EALLOW;
   IER = 0x0001;
@@ -97,16 +104,17 @@ int main(void)
   }
 
 }
+#endif
 
 interrupt void timer0(void)
 {
-  pinGPIOToogle(12);
+  pinGPIOHandleToogle(&led);
   PieCtrlRegs.PIEACK.bit.ACK1 = 1;
 
 }
 
-interrupt void adc0(void)
+void adc0(ADCType adc, ADC_IntType irq)
 {
-  PieCtrlRegs.PIEACK.bit.ACK1 = 1;
-  AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; //make sure INT1 flag is cleared
+  (void)adc;                        //flag and PIE are cleared by driver
+  (void)irq;
 }